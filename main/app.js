@@ -100,12 +100,24 @@ async function getInfo(url = "info.json") {
     var errCnt = (info.missed>0)?"   (errCnt=${info.missed})":"";
     gel("chargerState").innerHTML = `<div class="nfo">${charging}${errCnt}</div>`;
     gel("version").innerHTML = `<div class="nfo">${info.version}</div>`;
+    //average active time per cycle type, slowest phase between brackets
+    h = "";
+    var cycles = Object.keys(info.profile.cycles);
+    for(var i=0; i<cycles.length; i++) {
+      let c = info.profile.cycles[cycles[i]];
+      let ap_class = i ===  cycles.length - 1 ? "" : " brdb";
+      let slow = 0;
+      for(var p=1; p<c.phases.length; p++) if(c.phases[p][1]>c.phases[slow][1]) slow=p;
+      h += `<div class="nfo${ap_class}">${cycles[i]}: ${(c.total[1]/1000).toFixed(1)}ms x${c.count} (${info.profile.phases[slow]})</div>\n`;
+    };
+    gel("profileState").innerHTML = h;
   } catch (e) {
     console.log(e);
     console.info("invalid info returned from /info.json!");
     gel("version").innerHTML = `<div class="nfo">Unknown</div>`;
     gel("voltages").innerHTML = `<div class="nfo">Unknown</div>`;
     gel("chargerState").innerHTML = `<div class="nfo">Unknown</div>`;
+    gel("profileState").innerHTML = `<div class="nfo">Unknown</div>`;
   }
 }
 
@@ -1,11 +1,20 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "driver/spi_master.h"
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
 #include "driver/gpio.h"
 #include "bitmaps.h"
 #include "font.h"
+#include "profile.h"
+#include "waveform.h"
+#include "eink.h"
 
 #ifdef CONFIG_IDF_TARGET_ESP32
 #define EPD_HOST    HSPI_HOST
@@ -30,42 +39,116 @@
 #define EINK_SPI_MOSI 12
 #define EINK_SPI_CLK  25
 
-#define SPI_FREQUENCY 8000000
+//SPI clock. The display takes writes up to 20MHz, but how fast it
+//works depends on the wiring. So setup mode calibrates the clock
+//(eink_calibrate_spi) and till then it runs at SPI_FREQUENCY.
+//Reads are only specified up to 2.5MHz
+#define SPI_FREQUENCY       8000000
+#define SPI_MAX_FREQUENCY  20000000
+#define SPI_READ_FREQUENCY  2000000
 
 #define EINK_RESET_DELAY 10
 
+//ghosting a screen region may collect from partial updates before
+//it gets a full update. 0 for a full update every 10 minutes
+#ifdef CONFIG_EINK_GHOST_BUDGET
+#define EINK_GHOST_BUDGET CONFIG_EINK_GHOST_BUDGET
+#else
+#define EINK_GHOST_BUDGET 24
+#endif
+
+//longest wait for the busy line in msec
+#ifdef CONFIG_EINK_BUSY_TIMEOUT
+#define EINK_BUSY_TIMEOUT CONFIG_EINK_BUSY_TIMEOUT
+#else
+#define EINK_BUSY_TIMEOUT 7000
+#endif
+
+//tokens of the run length encoded bitmaps (tools/bitmap_pack.py)
+//the low 6 bits hold the number of bytes minus one
+#define RLE_LITERAL 0x00  //bytes follow the token
+#define RLE_WHITE   0x40  //run of 0xFF
+#define RLE_BLACK   0x80  //run of 0x00
+#define RLE_REPEAT  0xC0  //run of the byte following the token
+#define RLE_COUNT   0x3F
+
 static spi_device_handle_t spi;
+static spi_device_handle_t spiRead = NULL;  //the display at SPI_READ_FREQUENCY
+static SemaphoreHandle_t busyDone = NULL; //given on the falling edge of BUSY
+static int lightSleep = 0;                //light sleep while the display is busy
+
+//State of the display between wakes. Leaving deep sleep takes a
+//hardware reset, which clears all registers including the LUT. With
+//CONFIG_EINK_KEEP_AWAKE the display is not put in deep sleep, so the
+//next wake can skip the reset and, after a partial update, the LUT.
+//It costs the sleep mode current of the display (about 20uA vs 1uA)
+#define EINK_PANEL_OFF      0   //deep sleep or unknown. Needs a reset
+#define EINK_PANEL_AWAKE    1   //registers are kept
+RTC_DATA_ATTR static uint8_t panelState = EINK_PANEL_OFF;
+RTC_DATA_ATTR static uint8_t panelWaveform = WAVEFORM_NONE; //custom LUT in the display
+static int waveform = WAVEFORM_NONE;  //waveform of this update
 
 static const char* TAG = "Epd driver";
 
-//Wave from for partial update for Heltec 1.54 200x200 pixels
-static const unsigned char WF_PARTIAL[159] = {
-0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x6,0x0,0x0,0x0,0x0,0x0,0x1,
-0x1,0x1,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
-0x02,0x17,0x41,0xB0,0x32,0x28
-};	
-
-static const unsigned char WF_PARTIAL_MODE[10] = {
+static DRAM_ATTR const unsigned char WF_PARTIAL_MODE[10] = {
     0x00,0x00,0x00,0x00,0x00,
     0x40,0x00,0x00,0x00,0x00
 };
 
+//The display is attached twice, for writes and for reads, and a pin
+//can only carry the CS signal of one device. So CS is driven here
+static void IRAM_ATTR eink_spi_pre_transfer(spi_transaction_t *t) {
+    //DC level of the transaction is passed in the user field
+    gpio_set_level((gpio_num_t)EINK_DC, (int)(intptr_t)t->user);
+    gpio_set_level((gpio_num_t)EINK_SPI_CS, 0);
+}
+
+static void IRAM_ATTR eink_spi_post_transfer(spi_transaction_t *t) {
+    gpio_set_level((gpio_num_t)EINK_SPI_CS, 1);
+}
+
+static void IRAM_ATTR eink_busy_isr(void *arg) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(busyDone, &woken);
+    if(woken) portYIELD_FROM_ISR();
+}
+
+RTC_DATA_ATTR static uint32_t spiCalibrated = 0; //0: not read from NVS yet
+static uint32_t spiClock;   //clock of the device now
+
+//Attach the EPD to the SPI bus at clock hz
+static spi_device_handle_t eink_add_device(uint32_t hz, int queueSize) {
+    esp_err_t ret;
+    spi_device_handle_t handle;
+    //Config Frequency, CS is set by the callbacks
+    spi_device_interface_config_t devcfg={
+        .mode=0,  //SPI mode 0
+        .clock_speed_hz=hz,
+        .input_delay_ns=0,
+        .spics_io_num=-1,
+        .flags = (SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE),
+        .queue_size=queueSize,
+        .pre_cb=eink_spi_pre_transfer,  //sets DC and CS
+        .post_cb=eink_spi_post_transfer
+    };
+    ret=spi_bus_add_device(EPD_HOST, &devcfg, &handle);
+    ESP_ERROR_CHECK(ret);
+    return handle;
+}
+
+//Attach the EPD for writes at clock hz
+static void eink_add_write_device(uint32_t hz) {
+    esp_err_t ret;
+    spi = eink_add_device(hz, 5);
+    spiClock = hz;
+
+    //The display is the only one on the bus. Keep the bus for the whole
+    //wake (eink_read lends it to the read device) so polling
+    //transactions don't lock and unlock it each time
+    ret=spi_device_acquire_bus(spi, portMAX_DELAY);
+    ESP_ERROR_CHECK(ret);
+}
+
 static void eink_init_io(void) {
     //printf("MOSI: %d CLK: %d\nSPI_CS: %d DC: %d RST: %d BUSY: %d\n\n",
     //    EINK_SPI_MOSI, EINK_SPI_CLK, EINK_SPI_CS,EINK_DC,EINK_RST,EINK_BUSY);
@@ -77,15 +160,22 @@ static void eink_init_io(void) {
     gpio_reset_pin((gpio_num_t)EINK_SPI_CS);
     gpio_set_direction((gpio_num_t)EINK_SPI_CS, GPIO_MODE_OUTPUT);
     gpio_set_direction((gpio_num_t)EINK_DC, GPIO_MODE_OUTPUT);
-    gpio_set_direction((gpio_num_t)EINK_RST, GPIO_MODE_OUTPUT);
     gpio_set_direction((gpio_num_t)EINK_BUSY, GPIO_MODE_INPUT);
     gpio_set_pull_mode((gpio_num_t)EINK_BUSY, GPIO_PULLUP_ONLY);
 
     gpio_set_level((gpio_num_t)EINK_SPI_CS, 1);
     gpio_set_level((gpio_num_t)EINK_DC, 1);
-    gpio_set_level((gpio_num_t)EINK_RST, 1);
     
     esp_err_t ret;
+    //The display pulls BUSY low when it is done. Wake the waiting
+    //task on that edge instead of polling
+    if(busyDone==NULL) busyDone = xSemaphoreCreateBinary();
+    gpio_set_intr_type((gpio_num_t)EINK_BUSY, GPIO_INTR_NEGEDGE);
+    ret=gpio_install_isr_service(0);
+    if(ret!=ESP_ERR_INVALID_STATE) ESP_ERROR_CHECK(ret); //already installed is fine
+    ret=gpio_isr_handler_add((gpio_num_t)EINK_BUSY, eink_busy_isr, NULL);
+    ESP_ERROR_CHECK(ret);
+
     // MISO not used, only Master to Slave
     spi_bus_config_t buscfg={
         .mosi_io_num=EINK_SPI_MOSI,
@@ -95,33 +185,25 @@ static void eink_init_io(void) {
         .quadhd_io_num=-1,
         .max_transfer_sz=4094
     };
-    //Config Frequency and SS GPIO
-    spi_device_interface_config_t devcfg={
-        .mode=0,  //SPI mode 0
-        .clock_speed_hz=SPI_FREQUENCY,
-        .input_delay_ns=0,
-        .spics_io_num=EINK_SPI_CS,
-        .flags = (SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE),
-        .queue_size=5
-    };
-    // DISABLED Callbacks pre_cb/post_cb. SPI does not seem to behave the same
-    // CS / DC GPIO states the usual way
-
     //Initialize the SPI bus
     ret=spi_bus_initialize(EPD_HOST, &buscfg, DMA_CHAN);
     ESP_ERROR_CHECK(ret);
 
-    //Attach the EPD to the SPI bus
-    ret=spi_bus_add_device(EPD_HOST, &devcfg, &spi);
-    ESP_ERROR_CHECK(ret);
-    
+    eink_add_write_device(spiCalibrated?spiCalibrated:SPI_FREQUENCY);
+
     //printf("EpdSpi::init() Debug enabled. SPI master at frequency:%d  MOSI:%d CLK:%d CS:%d DC:%d RST:%d BUSY:%d\n",
     //  SPI_FREQUENCY, EINK_SPI_MOSI, EINK_SPI_CLK, EINK_SPI_CS,
     //  EINK_DC,EINK_RST,EINK_BUSY);
 }
 
+static void eink_wait_bands(void);
+
 void eink_shutdown_io(void)
 {
+    eink_wait_bands();
+    spi_device_release_bus(spi);
+    //the ULP takes over BUSY
+    gpio_isr_handler_remove((gpio_num_t)EINK_BUSY);
     //ESP_ERROR_CHECK(spi_bus_remove_device(spi));
     //ESP_ERROR_CHECK(spi_bus_free(EPD_HOST));
     //gpio_reset_pin((gpio_num_t)EINK_BUSY);
@@ -131,84 +213,300 @@ void eink_shutdown_io(void)
     //gpio_reset_pin((gpio_num_t)EINK_DC);
 }
 
-static void eink_cmd(const uint8_t cmd)
+//Small transfers (up to 4 bytes) are sent from the transaction itself
+//so the driver doesn't need to set up DMA descriptors for them.
+//Larger transfers are sent by DMA straight from the buffer
+#define EINK_SMALL_TRANSFER 4
+
+//Frame data is queued in bands and sent by DMA in the background, so
+//the cpu can collect the next band of a window while the previous one
+//is on the bus. The queue holds as many bands as the device queue_size
+#define EINK_QUEUE_SIZE 5
+#define EINK_BAND_SIZE  1024    //bytes per queued transaction at most
+
+static spi_transaction_t bandTrans[EINK_QUEUE_SIZE];
+static int bandsQueued = 0;
+static int bandNext = 0;        //oldest transaction when the queue is full
+
+static void eink_band_done(void)
 {
-    //printf("C %x\n",cmd);
+    spi_transaction_t *t;
+    int phase=profile_phase(PROFILE_EINK_SPI);
+    esp_err_t ret=spi_device_get_trans_result(spi, &t, portMAX_DELAY);
+    profile_phase(phase);
+    assert(ret==ESP_OK);
+    bandsQueued--;
+}
+
+//wait till all queued bands are sent. Polling transactions
+//can't be used while queued ones are pending
+static void eink_wait_bands(void)
+{
+    while(bandsQueued>0) eink_band_done();
+}
+
+//queue len bytes of data. data must stay untouched till it is sent
+static void eink_queue_band(const uint8_t *data, int len)
+{
+    if(bandsQueued==EINK_QUEUE_SIZE) eink_band_done();
+    spi_transaction_t *t = &bandTrans[bandNext];
+    bandNext = (bandNext+1)%EINK_QUEUE_SIZE;
+    memset(t, 0, sizeof(*t));
+    t->length=len*8;
+    t->tx_buffer=data;
+    t->user=(void *)1;              //DC high, it is data
+    int phase=profile_phase(PROFILE_EINK_SPI);
+    esp_err_t ret=spi_device_queue_trans(spi, t, portMAX_DELAY);
+    profile_phase(phase);
+    assert(ret==ESP_OK);
+    bandsQueued++;
+}
 
+//switch the SPI clock to hz
+static void eink_spi_clock(uint32_t hz)
+{
+    if(hz==spiClock) return;
+    eink_wait_bands();
+    spi_device_release_bus(spi);
+    ESP_ERROR_CHECK(spi_bus_remove_device(spi));
+    eink_add_write_device(hz);
+}
+
+static void eink_write(const uint8_t *data, int len, int dc)
+{
     esp_err_t ret;
     spi_transaction_t t;
+    eink_wait_bands();
     memset(&t, 0, sizeof(t));       //Zero out the transaction
-    t.length=8;                     //Command is 8 bits
-    t.tx_buffer=&cmd;               //The data is the cmd itself 
-    // No need to toogle CS when spics_io_num is defined in SPI config struct
-    //gpio_set_level((gpio_num_t)EINK_SPI_CS, 0);
-    gpio_set_level((gpio_num_t)EINK_DC, 0);
-    ret=spi_device_polling_transmit(spi, &t);
+    t.length=len*8;                 //Len is in bytes, transaction length is in bits.
+    t.user=(void *)(intptr_t)dc;    //DC level, set by eink_spi_pre_transfer
+    if(len<=EINK_SMALL_TRANSFER) {
+        t.flags=SPI_TRANS_USE_TXDATA;
+        memcpy(t.tx_data, data, len);
+    } else {
+        t.tx_buffer=data;
+    }
+    int phase=profile_phase(PROFILE_EINK_SPI);
+    ret=spi_device_polling_transmit(spi, &t);  //Transmit!
+    profile_phase(phase);
+    assert(ret==ESP_OK);            //Should have had no issues.
+}
 
-    assert(ret==ESP_OK);
-    gpio_set_level((gpio_num_t)EINK_DC, 1);
+//Command list
+//Commands and their data are collected in a list instead of being sent
+//one byte per transaction. The list is sent when the display has to act
+//on it: before waiting for the busy line and on an update. Consecutive
+//bytes with the same DC level are sent in one transaction.
+#define EINK_LIST_SIZE  64  //bytes
+#define EINK_LIST_RUNS  16  //transactions
+#define EINK_LIST_MAX   16  //longer data buffers are sent directly
+
+typedef struct {
+    uint8_t start;
+    uint8_t len;
+    uint8_t dc;
+} eink_run_t;
+
+static DMA_ATTR uint8_t listBuffer[EINK_LIST_SIZE];
+static eink_run_t listRuns[EINK_LIST_RUNS];
+static int listLen = 0;
+static int listRunCount = 0;
+
+static void eink_flush(void)
+{
+    for(int i=0; i<listRunCount; i++) {
+        eink_write(listBuffer+listRuns[i].start, listRuns[i].len, listRuns[i].dc);
+    }
+    listLen = 0;
+    listRunCount = 0;
+}
+
+static void eink_list_add(const uint8_t *data, int len, int dc)
+{
+    if(listLen+len>EINK_LIST_SIZE) eink_flush();
+    if(listRunCount==0 || listRuns[listRunCount-1].dc!=dc) {
+        //DC changes so start a new transaction
+        if(listRunCount==EINK_LIST_RUNS) eink_flush();
+        listRuns[listRunCount].start = listLen;
+        listRuns[listRunCount].len = 0;
+        listRuns[listRunCount].dc = dc;
+        listRunCount++;
+    }
+    eink_run_t *run = &listRuns[listRunCount-1];
+    memcpy(listBuffer+listLen, data, len);
+    listLen += len;
+    run->len += len;
+}
+
+static void eink_cmd(const uint8_t cmd)
+{
+    //printf("C %x\n",cmd);
+    // No need to toogle CS when spics_io_num is defined in SPI config struct
+    eink_list_add(&cmd, 1, 0);
 }
 
 static void eink_data(uint8_t data)
 {
     //printf("D %x\n",data);
-    esp_err_t ret;
-    spi_transaction_t t;
-    memset(&t, 0, sizeof(t));       //Zero out the transaction
-    t.length=8;                     //Data is 8 bits
-    t.tx_buffer=&data;              //Use the data itself
-    ret=spi_device_polling_transmit(spi, &t);
-    
-    assert(ret==ESP_OK);
+    eink_list_add(&data, 1, 1);
 }
 
 static void eink_dataBuffer(const uint8_t *data, int len)
 {
     if (len==0) return; 
+    if(len<=EINK_LIST_MAX) {
+        eink_list_add(data, len, 1);
+    } else {
+        //send pending commands first, then the buffer without copying
+        //it. A single band is polled, queueing it costs more than it saves
+        eink_flush();
+        if(len<=EINK_BAND_SIZE) {
+            eink_write(data, len, 1);
+            return;
+        }
+        for(int i=0; i<len; i+=EINK_BAND_SIZE) {
+            eink_queue_band(data+i, (len-i<EINK_BAND_SIZE)?len-i:EINK_BAND_SIZE);
+        }
+    }
+}
+
+//read len bytes the display returns for cmd, at the read clock
+//More than 4 bytes are read by DMA, so data must be DMA capable
+//Reads go through a second device, attached on the first read of a
+//wake. Handing the bus to it is cheaper than changing the clock of
+//the write device there and back
+static void eink_read(uint8_t cmd, uint8_t *data, int len)
+{
     esp_err_t ret;
     spi_transaction_t t;
-                
-    memset(&t, 0, sizeof(t));       //Zero out the transaction
-    t.length=len*8;                 //Len is in bytes, transaction length is in bits.
-    t.tx_buffer=data;               //Data
-    ret=spi_device_polling_transmit(spi, &t);  //Transmit!
-    assert(ret==ESP_OK);            //Should have had no issues.
+    eink_cmd(cmd);
+    eink_flush();
+    eink_wait_bands();
+    if(spiRead==NULL) spiRead = eink_add_device(SPI_READ_FREQUENCY, 1);
+    spi_device_release_bus(spi);
+    ret=spi_device_acquire_bus(spiRead, portMAX_DELAY);
+    ESP_ERROR_CHECK(ret);
+    memset(&t, 0, sizeof(t));
+    t.rxlength=len*8;               //SDA turns around after the command
+    t.user=(void *)1;               //DC high for the data bytes
+    if(len<=EINK_SMALL_TRANSFER) t.flags=SPI_TRANS_USE_RXDATA;
+    else t.rx_buffer=data;
+    int phase=profile_phase(PROFILE_EINK_SPI);
+    ret=spi_device_polling_transmit(spiRead, &t);
+    profile_phase(phase);
+    assert(ret==ESP_OK);
+    if(len<=EINK_SMALL_TRANSFER) memcpy(data, t.rx_data, len);
+    spi_device_release_bus(spiRead);
+    ret=spi_device_acquire_bus(spi, portMAX_DELAY);
+    ESP_ERROR_CHECK(ret);
+}
+
+//Allow the cpu to light sleep while waiting for the display.
+//Only when nothing else needs the cpu in the mean time
+void eink_set_light_sleep(int enable) {
+    lightSleep = enable;
+}
+
+//light sleep for at most us usec. With onBusy set, the falling
+//BUSY line wakes the cpu too. SPI and GPIO keep their state
+static void eink_light_sleep(int64_t us, int onBusy) {
+    int phase=profile_phase(PROFILE_LIGHT_SLEEP);
+    if(onBusy) {
+        //BUSY can only wake on a level. Keep the edge interrupt
+        //from seeing the wake up level
+        gpio_intr_disable((gpio_num_t)EINK_BUSY);
+        gpio_wakeup_enable((gpio_num_t)EINK_BUSY, GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+    }
+    esp_sleep_enable_timer_wakeup(us);
+    esp_light_sleep_start();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    if(onBusy) {
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+        gpio_wakeup_disable((gpio_num_t)EINK_BUSY);
+        gpio_set_intr_type((gpio_num_t)EINK_BUSY, GPIO_INTR_NEGEDGE);
+        gpio_intr_enable((gpio_num_t)EINK_BUSY);
+    }
+    profile_phase(phase);
+}
+
+static void eink_delay(int ms) {
+    if(lightSleep) eink_light_sleep(ms*1000LL, 0);
+    else vTaskDelay(ms / portTICK_RATE_MS);
 }
 
-static void eink_waitBusy(const char* message){
+static void eink_waitBusy(int busy, const char* message){
   ESP_LOGI(TAG, "_waitBusy for %s", message);
-  int64_t time_since_boot = esp_timer_get_time();
+  eink_flush(); //the display can only get busy on what it has received
+  int64_t start = esp_timer_get_time();
+  int64_t timeout = start+EINK_BUSY_TIMEOUT*1000LL;
+  int phase=profile_phase(PROFILE_EINK_BUSY);
 
-  while (1){
-    // On low is not busy anymore
-    if (gpio_get_level((gpio_num_t)EINK_BUSY) == 0) break;
-    vTaskDelay(10 / portTICK_RATE_MS);
-    if (esp_timer_get_time()-time_since_boot>7000000)
+  //drop the edge of an earlier wait, then sleep till the falling
+  //edge of BUSY. The level is checked first as the display may
+  //already be done and after a wake up in case of a glitch
+  xSemaphoreTake(busyDone, 0);
+  if (lightSleep && gpio_get_level((gpio_num_t)EINK_BUSY) != 0) {
+    eink_light_sleep(timeout-start, 1);
+  }
+  while (gpio_get_level((gpio_num_t)EINK_BUSY) != 0) {
+    int64_t left = timeout-esp_timer_get_time();
+    if (left<=0 || xSemaphoreTake(busyDone, pdMS_TO_TICKS(left/1000)+1) != pdTRUE)
     {
       ESP_LOGI(TAG, "Busy Timeout");
       break;
     }
   }
+  profile_busy(busy, (uint32_t)(esp_timer_get_time()-start));
+  profile_phase(phase);
 }
 
-static void eink_init_partial(void) {
+//load the custom LUT of waveform wf and the settings for its display mode
+static void eink_load_waveform(int wf) {
+    const waveform_t *w = &waveforms[wf];
+    waveform = wf;
+    //the OTP waveform is loaded by eink_init
+    if(w->lut==NULL) return;
+    if(panelState==EINK_PANEL_AWAKE && panelWaveform==wf) return; //still loaded from last wake
     eink_cmd(0x32); //set LUT
-    eink_dataBuffer(WF_PARTIAL, 153);
-    eink_waitBusy("load LUT");
-    eink_cmd(0x3F); //gate voltage
-    eink_data(WF_PARTIAL[153]);
+    eink_dataBuffer(w->lut, 153);
+    eink_waitBusy(PROFILE_BUSY_LUT, "load LUT");
+    eink_cmd(0x3F); //option for LUT end
+    eink_data(w->lut[153]);
     eink_cmd(0x03); //gate voltage
-    eink_data(WF_PARTIAL[154]);
+    eink_data(w->lut[154]);
     eink_cmd(0x04); //source voltage
-    eink_data(WF_PARTIAL[155]);
-    eink_data(WF_PARTIAL[156]);
-    eink_data(WF_PARTIAL[157]);
+    eink_data(w->lut[155]);
+    eink_data(w->lut[156]);
+    eink_data(w->lut[157]);
     eink_cmd(0x2C); //vcom
-    eink_data(WF_PARTIAL[158]);
+    eink_data(w->lut[158]);
+    //display mode 2 with ping pong: the red RAM follows the screen
     eink_cmd(0x37); //active waveform
     eink_dataBuffer(WF_PARTIAL_MODE, 10);
-    eink_cmd(0x3C); //border
-    eink_data(0x80);
+    if(w->update!=EINK_FULL) {
+        eink_cmd(0x3C); //border
+        eink_data(0x80);
+    }
+    panelWaveform = wf;
+}
+
+//Custom waveforms run in display mode 2 with RAM ping pong, so the
+//display copies the black/white RAM into the red RAM after the update.
+//The full ones drive a pixel the same whatever its red bit is (LUT0 ==
+//LUT2 and LUT1 == LUT3), so the red RAM doesn't need the new screen
+//first. Only the OTP waveform runs in mode 1, which has no ping pong
+static int eink_mirrors_red(void) {
+    return waveform!=WAVEFORM_NONE && waveforms[waveform].lut!=NULL;
+}
+
+//temperature measured by the display in degrees C. The last
+//0x22 sequence must have loaded it (0x22 0xB1)
+static int eink_read_temperature(void) {
+    uint8_t t[2];
+    eink_read(0x1B, t, 2);
+    //12 bits in 1/16 degrees. The first byte holds the whole degrees
+    return (int8_t)t[0];
 }
 
 
@@ -221,45 +519,93 @@ void eink_reset(void) {
 
 void eink_start(void) {
     //TODO: power on eink display
+    //after any other reset than a wake from deep sleep the
+    //state in RTC memory can't be trusted
+    if(esp_reset_reason()!=ESP_RST_DEEPSLEEP) panelState = EINK_PANEL_OFF;
+    if(panelState!=EINK_PANEL_OFF) {
+        //display stayed awake. No need to reset it, but RST is back
+        //to its default state after deep sleep. Keep it released
+        gpio_set_level((gpio_num_t)EINK_RST, 1);
+        gpio_set_direction((gpio_num_t)EINK_RST, GPIO_MODE_OUTPUT);
+        eink_init_io();
+        return;
+    }
+    //Setting up the SPI bus takes a while. Do it while the display
+    //is held in reset and only wait for what is left of the reset time
+    gpio_set_direction((gpio_num_t)EINK_RST, GPIO_MODE_OUTPUT);
+    gpio_set_level((gpio_num_t)EINK_RST, 0);
+    int64_t resetStart = esp_timer_get_time();
     eink_init_io();
-    eink_reset();
-    eink_waitBusy("epd_reset");
+    int64_t left = EINK_RESET_DELAY*1000LL-(esp_timer_get_time()-resetStart);
+    if(left>0) {
+        if(lightSleep) eink_light_sleep(left, 0);
+        else esp_rom_delay_us((uint32_t)left);
+    }
+    gpio_set_level((gpio_num_t)EINK_RST, 1);
+    eink_delay(EINK_RESET_DELAY);
+    eink_waitBusy(PROFILE_BUSY_RESET, "epd_reset");
+    panelState = EINK_PANEL_AWAKE;
+    panelWaveform = WAVEFORM_NONE;
 }
 
 void eink_init(int fullUpdate) {
-    if(!fullUpdate) {
-        eink_init_partial();
+    if(fullUpdate==EINK_PARTIAL || fullUpdate==EINK_REGIONAL) {
+        eink_load_waveform(waveform_select(fullUpdate));
         return;
     }
     //TODO: initialize display
     //send power on sequence to diplay
     eink_cmd(0x12); // soft reset
-    eink_waitBusy("epd_wakeup_power:ON");
+    eink_waitBusy(PROFILE_BUSY_SWRESET, "epd_wakeup_power:ON");
+    panelState = EINK_PANEL_AWAKE;
+    panelWaveform = WAVEFORM_NONE; //the LUT is replaced by the OTP one
 
     eink_cmd(0x01); // Driver output control
     eink_data(0xC7);
     eink_data(0x00);
     eink_data(0x00);
 
-    eink_cmd(0x1A); // set temperatur to 25 degrees to select apropriate LUT
-    eink_data(0x19);
-    eink_data(0x00);
-
+    //measure the temperature and load the OTP waveform for it
+    eink_cmd(0x18); //temperature sensor
+    eink_data(0x80); //internal
     eink_cmd(0x22);
-    eink_data(0x91);
+    eink_data(0xB1);
     eink_cmd(0x20);
-    eink_waitBusy("PowerOn");
+    eink_waitBusy(PROFILE_BUSY_POWERON, "PowerOn");
+    waveform_temperature(eink_read_temperature());
+    eink_load_waveform(waveform_select(fullUpdate));
 }
 
 void eink_stop(void) {
-    eink_waitBusy("Power off");
+    eink_waitBusy(PROFILE_BUSY_UPDATE, "Power off");
     //goto deep sleep
     eink_cmd(0x10);
     eink_data(0x01);
+    eink_flush();
+    panelState = EINK_PANEL_OFF;
+    panelWaveform = WAVEFORM_NONE;
     //eink_shutdown_io();
     //TODO: gpio to minimal
 }
 
+//The wake is done with the display. Put it in deep sleep unless it
+//is kept awake. Returns 1 if the display is still busy updating, so
+//the ULP has to send it to deep sleep once it is done
+int eink_sleep(void) {
+#if CONFIG_EINK_KEEP_AWAKE
+    //the update ends with the analog part and the clock disabled
+    return 0;
+#else
+    if(gpio_get_level((gpio_num_t)EINK_BUSY)) {
+        panelState = EINK_PANEL_OFF;
+        panelWaveform = WAVEFORM_NONE;
+        return 1;
+    }
+    eink_stop();
+    return 0;
+#endif
+}
+
 void static eink_set_rampointer(int top, int right, int width, int height) {
     //top in lines, left in multiples of 8 pixels rounded down
     //set ram area
@@ -279,7 +625,7 @@ void static eink_set_rampointer(int top, int right, int width, int height) {
     eink_cmd(0x4F);
     eink_data(right);
     eink_data(0);
-    eink_waitBusy("set ram");
+    eink_waitBusy(PROFILE_BUSY_RAM, "set ram");
 }
 
 
@@ -290,19 +636,40 @@ void static eink_draw_bitmap(const uint8_t *bitmap, int top, int right, int widt
     //each line is written top to botttom
     //bitmaps must be rotated and must consist of full bytes. No bit shifting
     //Bytes in the image buffer not covered by the bitmap are untouched
+    //The bitmap bytes are run length encoded by tools/bitmap_pack.py
+    //(see RLE_* above). Runs may continue on the next line.
     //first skip right*height bytes to move to required start positon
-    int p = right*height;
     uint8_t bitmapWidth =  *bitmap++;
     uint8_t bitmapHeight = *bitmap++;
-    for(uint8_t x=0; x<bitmapWidth; x++) {
-        //for each (vertical) line skip top bytes
-        p+=top;
-        for(uint8_t y=0; y<bitmapHeight; y++) {
-            //now copy one line of the bitmap into the imageBuffer
-            if(p>=sizeof(imageBuffer)) return; // out of buffer space
-            imageBuffer[p++]=*bitmap++;
+    uint8_t *p = imageBuffer+right*height+top;
+    uint8_t *end = imageBuffer+sizeof(imageBuffer);
+    int y = 0;
+    int left = bitmapWidth*bitmapHeight;
+    while(left>0) {
+        uint8_t token = *bitmap++;
+        int n = (token&RLE_COUNT)+1;
+        uint8_t kind = token&~RLE_COUNT;
+        uint8_t value = (kind==RLE_WHITE)?0xFF:(kind==RLE_BLACK)?0x00:(kind==RLE_REPEAT)?*bitmap++:0;
+        if(n>left) n = left;
+        left -= n;
+        while(n>0) {
+            //copy up to the end of the current line
+            int chunk = bitmapHeight-y;
+            if(chunk>n) chunk = n;
+            if(chunk>end-p) return; // out of buffer space
+            if(kind==RLE_LITERAL) {
+                memcpy(p, bitmap, chunk);
+                bitmap += chunk;
+            } else memset(p, value, chunk);
+            p += chunk;
+            n -= chunk;
+            y += chunk;
+            if(y==bitmapHeight) {
+                //skip to the top of the next line
+                p += height-bitmapHeight;
+                y = 0;
+            }
         }
-        p+=height-top-bitmapHeight;
     }
 }
 
@@ -337,7 +704,6 @@ void eink_invert_block(int top, int right, int blockWidth, int blockHeight, int
 }
 
 static void eink_batteries(int b1, int b2, int b3) {
-    //batteries are only drawn in full update
     if(b3<0) {
          //show just two batteries. (b2 left and b1 right)
          if(b2>=0 && b2<=3) eink_draw_bitmap(bitmaps[BITMAP_BAT0+b2], 21, 158, 200, 25);
@@ -355,73 +721,356 @@ static void eink_batteries(int b1, int b2, int b3) {
     }
 }
 
-static void eink_sync(int sync, int fullUpdate) {
-    //location differs for full and partial updates
-    if(fullUpdate) {
-        if(sync>=0 && sync<7) eink_draw_bitmap(bitmaps[BITMAP_SYNC0+sync], 20, 10, 200, 25);
-        else eink_draw_bitmap(bitmaps[BITMAP_SYNC7], 20, 10, 200, 25);
-    } else {
-        if(sync>=0 && sync<7) eink_draw_bitmap(bitmaps[BITMAP_SYNC0+sync], 18, 2, 84, 23);
-        else eink_draw_bitmap(bitmaps[BITMAP_SYNC7], 18, 2, 84, 23);
-    }
+static void eink_sync(int sync) {
+    if(sync>=0 && sync<7) eink_draw_bitmap(bitmaps[BITMAP_SYNC0+sync], 20, 10, 200, 25);
+    else eink_draw_bitmap(bitmaps[BITMAP_SYNC7], 20, 10, 200, 25);
 }
 
-static void eink_charge(int chargeState, int fullUpdate) {
-    //chargeState<0 means charge state has not changed
-    //this function is never invoked when chargeState<0
-    //charge state==0 means don't draw any icon. section should already be blank
+static void eink_charge(int chargeState) {
+    //charge state==0 means don't draw any icon
     //there are 4 charge state symbols. only use two lowest bits
     //this allows us to use BITMAP_CHARGING0 by using chargeState==4
-    if(chargeState==0) return;
+    if(chargeState<=0) return;
     chargeState&=3;
-    //location differs for full and partial updates
-    if(fullUpdate) {
-        eink_draw_bitmap(bitmaps[BITMAP_CHARGING0+chargeState], 20, 50, 200, 25);
-    } else {
-        eink_draw_bitmap(bitmaps[BITMAP_CHARGING0+chargeState], 18, 42, 84, 23);
+    eink_draw_bitmap(bitmaps[BITMAP_CHARGING0+chargeState], 20, 50, 200, 25);
+}
+
+//Description of what the display RAM holds. Kept in RTC memory as the
+//display keeps its RAM in deep sleep, so every wake knows what is on
+//screen. Not valid after a reset or in setup mode.
+typedef struct {
+    uint8_t valid;
+    uint8_t num;
+    int8_t  b1, b2, b3;
+    int8_t  sync;
+    int8_t  charge;
+} eink_frame_t;
+
+RTC_DATA_ATTR static eink_frame_t panelFrame = { 0 };
+
+//panelFrame drawn, used to find the changes. Afterwards
+//it is used to collect the bytes of the window to send
+static DMA_ATTR uint8_t panelBuffer[5000];
+
+static void eink_draw_frame(const eink_frame_t *frame) {
+    uint8_t ones = frame->num%10;
+    uint8_t tens = (frame->num/10)%10;
+    memset(imageBuffer, 0xFF, 5000); //clear entire buffer
+    eink_draw_bitmap(digits[ones], 2, 8, 200, 25);
+    eink_draw_bitmap(digits[tens], 2, 108, 200, 25);
+    eink_batteries(frame->b1, frame->b2, frame->b3);
+    eink_sync(frame->sync);
+    eink_charge(frame->charge);
+}
+
+//find the smallest window holding all bytes of the image buffer
+//that differ from the display RAM. Returns 0 when nothing changed
+static int eink_find_changes(int *top, int *right, int *width, int *height) {
+    if(!panelFrame.valid) {
+        //don't know what the display holds. Everything changed
+        *top = 0;
+        *right = 0;
+        *width = 200;
+        *height = 25;
+        return 1;
     }
+    //the image buffer holds 200 lines of 25 bytes
+    int first=25, last=-1, firstLine=200, lastLine=-1;
+    for(int line=0; line<200; line++) {
+        const uint8_t *img = imageBuffer+line*25;
+        const uint8_t *pnl = panelBuffer+line*25;
+        if(memcmp(img, pnl, 25)==0) continue;
+        int f=0, l=24;
+        while(img[f]==pnl[f]) f++;
+        while(img[l]==pnl[l]) l--;
+        if(f<first) first=f;
+        if(l>last) last=l;
+        if(line<firstLine) firstLine=line;
+        lastLine=line;
+    }
+    if(lastLine<0) return 0;
+    *top = first;
+    *right = firstLine;
+    *width = lastLine-firstLine+1;
+    *height = last-first+1;
+    return 1;
 }
 
-void eink_display_number(uint8_t num, int b1, int b2, int b3, int sync, int chargeState, int fullUpdate) {
-    //set ram pointer
-    uint8_t ones = num%10;
-    uint8_t tens = (num/10)%10;
-
-    if(fullUpdate) {
-        //write screen data
-        memset(imageBuffer, 0xFF, 5000); //clear entire buffer
-        eink_draw_bitmap(digits[ones], 2, 8, 200, 25);
-        eink_draw_bitmap(digits[tens], 2, 108, 200, 25);
-        eink_batteries(b1, b2, b3);
-        eink_sync(sync, fullUpdate);
-        eink_charge(chargeState, fullUpdate);
-        
-        eink_set_rampointer(0, 0, 200, 25); //full frame 200 x (25*8) pixels starting at 0,0 (top,right)
-        eink_cmd(0x24);
-        eink_dataBuffer(imageBuffer, 5000);
-        eink_set_rampointer(0, 0, 200, 25); //full frame 200 x (25*8) pixels starting at 0,0 (top,right)
-        eink_cmd(0x26);
+//bytes of panelBuffer holding bands that may still be queued
+static int bandUsed = 0;
+
+//room for a band of len bytes in panelBuffer. Waits for the queued
+//bands when it runs out. Bands start word aligned for the DMA
+static uint8_t *eink_band_buffer(int len) {
+    if(bandUsed+len>(int)sizeof(panelBuffer)) {
+        eink_wait_bands();
+        bandUsed = 0;
+    }
+    uint8_t *band = panelBuffer+bandUsed;
+    bandUsed = (bandUsed+len+3)&~3;
+    return band;
+}
+
+//collect lines of a window of the image buffer into a band
+static uint8_t *eink_gather_band(int top, int line, int lines, int height, int invert) {
+    uint8_t *band = eink_band_buffer(lines*height);
+    uint8_t *p = band;
+    for(int i=0; i<lines; i++) {
+        memcpy(p, imageBuffer+(line+i)*25+top, height);
+        if(invert) {
+            for(int j=0; j<height; j++) p[j]^=0xFF;
+        }
+        p+=height;
+    }
+    return band;
+}
+
+//write a window of the image buffer into display RAM 0x24 or 0x26
+//invert writes the inverse of the image, see WF_REGIONAL
+//A window that isn't the whole frame is collected band by band. The
+//first band is collected while the previous window is still being
+//sent, every next one while the band before it is on the bus
+static void eink_write_window(uint8_t ram, int top, int right, int width, int height, int invert) {
+    if(width==200 && height==25 && !invert) {
+        //the whole frame goes out straight from the image buffer
+        eink_set_rampointer(top, right, width, height);
+        eink_cmd(ram);
         eink_dataBuffer(imageBuffer, 5000);
-    } else {
-        //init partial update
-        //write screen data
-        if(chargeState<0) {
-            //No change in charging indicator so we only need to replace the ones
-            eink_draw_bitmap(digits[ones], 0, 0, 84, 17);
-            eink_set_rampointer(2, 8, 84, 17); //full frame 84 x (17*8) pixels starting at 2*8=  16,8 (top,right)
-            eink_cmd(0x24);
-            eink_dataBuffer(imageBuffer, 1428);
-        } else {
-            //new value for charging indicator so update ones and the charging and sync indicators
-            memset(imageBuffer, 0xFF, 1932); //clear entire buffer
-            eink_draw_bitmap(digits[ones], 0, 0, 84, 23);
-            eink_sync(sync, fullUpdate);
-            eink_charge(chargeState, fullUpdate);
-            eink_set_rampointer(2, 8, 84, 23); //full frame 84 x (23*8) pixels starting at 2*8=  16,8 (top,right)
-            eink_cmd(0x24);
-            eink_dataBuffer(imageBuffer, 1932);
+        return;
+    }
+    if(bandsQueued==0) bandUsed = 0;
+    int lines = EINK_BAND_SIZE/height;
+    int n = (width<lines)?width:lines;
+    uint8_t *band = eink_gather_band(top, right, n, height, invert);
+    eink_set_rampointer(top, right, width, height);
+    eink_cmd(ram);
+    eink_flush();
+    for(int line=right; line<right+width; line+=n) {
+        n = (right+width-line<lines)?right+width-line:lines;
+        if(line!=right) band = eink_gather_band(top, line, n, height, invert);
+        if(width<=lines) eink_write(band, n*height, 1);
+        else eink_queue_band(band, n*height);
+    }
+}
+
+//frame drawn by eink_draw_number and the window that changed
+static eink_frame_t nextFrame;
+static int changed, changedTop, changedRight, changedWidth, changedHeight;
+
+//Regions of the clock screen. Partial updates leave a little ghosting
+//behind in the regions they change. It is counted per region (see
+//waveform_t) till a full update clears it
+#define EINK_REGION_ONES   0
+#define EINK_REGION_TENS   1
+#define EINK_REGION_ICONS  2
+#define EINK_REGIONS       3
+
+typedef struct {
+    uint8_t top, height;    //bytes
+    uint8_t right, width;   //lines
+} eink_region_t;
+
+//the digits are 84 lines of 17 bytes, see eink_draw_frame
+static const eink_region_t regions[EINK_REGIONS] = {
+    [EINK_REGION_ONES]  = {  2, 17,   8,  84 },
+    [EINK_REGION_TENS]  = {  2, 17, 108,  84 },
+    [EINK_REGION_ICONS] = { 20,  5,   0, 200 },  //batteries, charger and sync
+};
+
+RTC_DATA_ATTR static uint16_t ghosting[EINK_REGIONS];
+static int regionsChanged;  //bit per region changed by the next frame
+
+static int eink_changed_regions(void) {
+    if(!panelFrame.valid) return (1<<EINK_REGIONS)-1;
+    int mask = 0;
+    for(int r=0; r<EINK_REGIONS; r++) {
+        const eink_region_t *g = &regions[r];
+        for(int line=g->right; line<g->right+g->width; line++) {
+            int p = line*25+g->top;
+            if(memcmp(imageBuffer+p, panelBuffer+p, g->height)!=0) {
+                mask |= 1<<r;
+                break;
+            }
+        }
+    }
+    return mask;
+}
+
+//draw the clock screen into the image buffer without touching the display
+//returns 0 when the display already shows exactly this screen
+int eink_draw_number(uint8_t num, int b1, int b2, int b3, int sync, int chargeState) {
+    nextFrame = (eink_frame_t){ 1, num, b1, b2, b3, sync, chargeState };
+    if(panelFrame.valid) {
+        eink_draw_frame(&panelFrame);
+        memcpy(panelBuffer, imageBuffer, sizeof(panelBuffer));
+    }
+    eink_draw_frame(&nextFrame);
+    changed = eink_find_changes(&changedTop, &changedRight, &changedWidth, &changedHeight);
+    regionsChanged = changed?eink_changed_regions():0;
+    return changed;
+}
+
+//Full update policy. Returns the update type for the screen drawn by
+//eink_draw_number. Changed icons get a full update (they are small
+//and ghost most visibly). When a partial update would take a digit
+//over the ghosting budget, the changed digits get a regional full
+//update. With a budget of 0 the caller keeps its fixed schedule
+int eink_select_update(void) {
+    if(EINK_GHOST_BUDGET==0) return EINK_PARTIAL;
+    if(!panelFrame.valid) return EINK_FULL;
+    if(regionsChanged&(1<<EINK_REGION_ICONS)) return EINK_FULL;
+    int add = waveforms[waveform_select(EINK_PARTIAL)].ghosting;
+    for(int r=0; r<EINK_REGIONS; r++) {
+        if((regionsChanged&(1<<r)) && ghosting[r]+add>EINK_GHOST_BUDGET) {
+            if(waveform_select(EINK_REGIONAL)==WAVEFORM_NONE) return EINK_FULL;
+            return EINK_REGIONAL;
+        }
+    }
+    return EINK_PARTIAL;
+}
+
+//Frame writes
+//Most of the frame is white and the BW RAM still holds the previous
+//frame. Instead of the whole frame, only windows with the bytes that
+//differ from what the RAM holds can be sent: the previous frame, or
+//white after the display cleared the RAM itself (0x47). A cost model
+//for the SPI clock picks the fastest way
+#define EINK_SPANS_MAX      24
+#define EINK_COST_BYTE_NS   (8000000000LL/spiClock)
+#define EINK_COST_WINDOW_NS 120000  //ram window, pointer and command: 10 transactions
+#define EINK_COST_CLEAR_NS  1100000 //auto write of the RAM and waiting for it
+
+typedef struct {
+    int count;
+    eink_region_t spans[EINK_SPANS_MAX];
+} eink_plan_t;
+
+static int64_t eink_span_cost(const eink_region_t *g) {
+    return EINK_COST_WINDOW_NS+(int64_t)g->width*g->height*EINK_COST_BYTE_NS;
+}
+
+//add the window of a run of lines to the plan. It is merged with the
+//window before it in the same column range when that is cheaper or
+//when the plan is full. Returns 0 when it doesn't fit
+static int eink_plan_add(eink_plan_t *plan, int rangeStart, const eink_region_t *g) {
+    if(plan->count>rangeStart) {
+        eink_region_t *prev = &plan->spans[plan->count-1];
+        int top = (g->top<prev->top)?g->top:prev->top;
+        int bottom = g->top+g->height;
+        if(prev->top+prev->height>bottom) bottom = prev->top+prev->height;
+        eink_region_t merged = { top, bottom-top, prev->right, g->right+g->width-prev->right };
+        if(plan->count==EINK_SPANS_MAX || eink_span_cost(&merged)<=eink_span_cost(prev)+eink_span_cost(g)) {
+            *prev = merged;
+            return 1;
+        }
+    }
+    if(plan->count==EINK_SPANS_MAX) return 0;
+    plan->spans[plan->count++] = *g;
+    return 1;
+}
+
+//plan the windows holding all bytes of the image buffer that differ
+//from ref (NULL for white). Byte columns without differences split the
+//frame in column ranges. In a range, every run of lines with
+//differences becomes a window. Returns the cost in nsec, -1 when
+//the windows don't fit in the plan
+static int64_t eink_plan_spans(const uint8_t *ref, eink_plan_t *plan) {
+    uint32_t columns = 0;
+    for(int i=0; i<5000; i++) {
+        if(imageBuffer[i]!=(ref?ref[i]:0xFF)) columns |= 1<<(i%25);
+    }
+    plan->count = 0;
+    for(int c0=0; c0<25; c0++) {
+        if(!(columns&(1<<c0))) continue;
+        int c1 = c0;
+        while(c1<24 && (columns&(1<<(c1+1)))) c1++;
+        int rangeStart = plan->count;
+        eink_region_t run = { 0, 0, 0, 0 };
+        for(int line=0; line<=200; line++) {
+            int f=-1, l=-1;
+            for(int c=c0; line<200 && c<=c1; c++) {
+                int i = line*25+c;
+                if(imageBuffer[i]==(ref?ref[i]:0xFF)) continue;
+                if(f<0) f = c;
+                l = c;
+            }
+            if(f>=0 && run.width) {
+                //the run goes on
+                int bottom = run.top+run.height;
+                if(l+1>bottom) bottom = l+1;
+                if(f<run.top) run.top = f;
+                run.height = bottom-run.top;
+                run.width++;
+            } else if(f>=0) {
+                run = (eink_region_t){ f, l-f+1, line, 1 };
+            } else if(run.width) {
+                if(!eink_plan_add(plan, rangeStart, &run)) return -1;
+                run.width = 0;
+            }
+        }
+        c0 = c1;
+    }
+    int64_t cost = 0;
+    for(int i=0; i<plan->count; i++) cost += eink_span_cost(&plan->spans[i]);
+    return cost;
+}
+
+//write the image buffer into the BW RAM. known is set when the
+//BW RAM holds the frame drawn in panelBuffer
+static void eink_write_frame(int known) {
+    static eink_plan_t plan, best;
+    eink_region_t frame = { 0, 25, 0, 200 };
+    int64_t cost = eink_span_cost(&frame);
+    int64_t c;
+    int spans = 0, clear = 0;
+    if(known && (c=eink_plan_spans(panelBuffer, &plan))>=0 && c<cost) {
+        cost = c;
+        best = plan;
+        spans = 1;
+    }
+    if((c=eink_plan_spans(NULL, &plan))>=0 && c+EINK_COST_CLEAR_NS<cost) {
+        cost = c+EINK_COST_CLEAR_NS;
+        best = plan;
+        spans = 1;
+        clear = 1;
+    }
+    ESP_LOGD(TAG, "frame in %d windows%s, %d usec", spans?best.count:1, clear?" after clear":"", (int)(cost/1000));
+    if(!spans) {
+        eink_write_window(0x24, 0, 0, 200, 25, 0);
+        return;
+    }
+    if(clear) {
+        eink_cmd(0x47); //auto write BW RAM
+        eink_data(0xD5); //white, a single step of 200 x 200
+        eink_waitBusy(PROFILE_BUSY_RAM, "clear ram");
+    }
+    for(int i=0; i<best.count; i++) {
+        const eink_region_t *g = &best.spans[i];
+        eink_write_window(0x24, g->top, g->right, g->width, g->height, 0);
+    }
+}
+
+//write the screen drawn by eink_draw_number into the display RAM
+void eink_display_frame(int fullUpdate) {
+    if(fullUpdate==EINK_REGIONAL) {
+        //only the changed digits. The red RAM gets their inverse
+        //so every pixel of them is driven, the rest is left alone
+        for(int r=0; r<EINK_REGIONS; r++) {
+            if(!(regionsChanged&(1<<r))) continue;
+            const eink_region_t *g = &regions[r];
+            eink_write_window(0x24, g->top, g->right, g->width, g->height, 0);
+            eink_write_window(0x26, g->top, g->right, g->width, g->height, 1);
         }
+    } else if(fullUpdate) {
+        //a full update shows the complete black/white RAM
+        eink_write_frame(panelFrame.valid);
+        //the red RAM still holds the previous screen so it only
+        //needs the changes, unless the display copies them itself
+        if(changed && !eink_mirrors_red()) eink_write_window(0x26, changedTop, changedRight, changedWidth, changedHeight, 0);
+    } else if(changed) {
+        eink_write_window(0x24, changedTop, changedRight, changedWidth, changedHeight, 0);
     }
+    panelFrame = nextFrame;
 }
 
 static void eink_draw_ip_for_setup(uint32_t ipaddress) {
@@ -440,6 +1089,82 @@ static void eink_draw_ip_for_setup(uint32_t ipaddress) {
     }
 }
 
+//Setup mode: find the fastest SPI clock the display takes reliably.
+//Test patterns are written into the first lines of the BW RAM at
+//increasing clocks and read back at the read clock. The commands are
+//always sent at SPI_FREQUENCY, a bad clock only spoils the pattern.
+//The lines are restored afterwards. The clock that is kept is one
+//step below the fastest one without errors, so a clock that only just
+//works at room temperature isn't used on a cold day. The caller keeps
+//it in NVS and passes it to eink_set_spi_clock after a reset
+#define EINK_CAL_LINES 8
+#define EINK_CAL_SIZE  (EINK_CAL_LINES*25)
+
+//80MHz divided by 10 down to 4
+static const uint32_t spiClocks[] = { 8000000, 10000000, 13333333, 16000000, 20000000 };
+
+//read the first lines of the BW RAM. The first byte read is a dummy
+static void eink_read_cal_lines(uint8_t *buffer) {
+    eink_cmd(0x41); //read RAM option
+    eink_data(0x00); //BW RAM
+    eink_set_rampointer(0, 0, EINK_CAL_LINES, 25);
+    eink_read(0x27, buffer, EINK_CAL_SIZE+1);
+}
+
+static void eink_write_cal_lines(const uint8_t *data, uint32_t hz) {
+    eink_set_rampointer(0, 0, EINK_CAL_LINES, 25);
+    eink_cmd(0x24);
+    eink_flush();
+    eink_spi_clock(hz);
+    eink_write(data, EINK_CAL_SIZE, 1);
+    eink_spi_clock(SPI_FREQUENCY);
+}
+
+uint32_t eink_calibrate_spi(void) {
+    static DMA_ATTR uint8_t saved[EINK_CAL_SIZE+4];
+    static DMA_ATTR uint8_t pattern[EINK_CAL_SIZE];
+    static DMA_ATTR uint8_t readBack[EINK_CAL_SIZE+4];
+    int passed = -1;    //fastest clock without errors
+    uint32_t seed = 1;
+    eink_spi_clock(SPI_FREQUENCY);
+    eink_read_cal_lines(saved);
+    for(int i=0; i<sizeof(spiClocks)/sizeof(spiClocks[0]); i++) {
+        int ok = 1;
+        //alternating bits first, then pseudo random bytes
+        for(int pass=0; pass<2 && ok; pass++) {
+            for(int j=0; j<EINK_CAL_SIZE; j++) {
+                seed = seed*1103515245+12345;
+                pattern[j] = pass?(uint8_t)(seed>>16):((j&1)?0x55:0xAA);
+            }
+            eink_write_cal_lines(pattern, spiClocks[i]);
+            eink_read_cal_lines(readBack);
+            ok = memcmp(pattern, readBack+1, EINK_CAL_SIZE)==0;
+        }
+        if(!ok) break;
+        passed = i;
+    }
+    uint32_t best = (passed>0)?spiClocks[passed-1]:SPI_FREQUENCY;
+    eink_write_cal_lines(saved+1, SPI_FREQUENCY);
+    ESP_LOGI(TAG, "SPI clock calibrated at %u Hz, %u Hz passed", (unsigned)best,
+             (unsigned)((passed>=0)?spiClocks[passed]:0));
+    eink_spi_clock(best);
+    spiCalibrated = best;
+    return best;
+}
+
+//SPI clock found by eink_calibrate_spi, 0 when not known (after a
+//reset). Takes effect when the display is started
+uint32_t eink_get_spi_clock(void) {
+    return spiCalibrated;
+}
+
+//0 when it was never calibrated, the display then runs at SPI_FREQUENCY
+void eink_set_spi_clock(uint32_t hz) {
+    if(hz>SPI_MAX_FREQUENCY) hz = SPI_MAX_FREQUENCY;
+    if(hz<SPI_FREQUENCY) hz = SPI_FREQUENCY;
+    spiCalibrated = hz;
+}
+
 //draw bitmap on the specified location
 //always using partial updates
 //the clock has initialized the display anyway
@@ -453,17 +1178,29 @@ void eink_display_setup(char *version, uint32_t ipaddress, char *ssid) {
     eink_invert_block(15, 72, 128, 5, 200, 25);
     eink_draw_text(ssid, 8, 20, 200, 200, 25);
     if(ipaddress!=0) eink_draw_ip_for_setup(ipaddress);
-    eink_set_rampointer(0, 0, 200, 25); //full frame 200 x (25*8) pixels starting at 0,0 (top,right)
-    eink_cmd(0x24);
-    eink_dataBuffer(imageBuffer, 5000);
-    eink_set_rampointer(0, 0, 200, 25); //full frame 200 x (25*8) pixels starting at 0,0 (top,right)
-    eink_cmd(0x26);
-    eink_dataBuffer(imageBuffer, 5000);
+    eink_write_frame(0);
+    if(!eink_mirrors_red()) {
+        eink_set_rampointer(0, 0, 200, 25);
+        eink_cmd(0x26);
+        eink_dataBuffer(imageBuffer, 5000);
+    }
+    panelFrame.valid = 0; //setup screen is not a clock frame
 }
 
 void eink_update(int fullUpdate) {
+    int full = (fullUpdate!=EINK_PARTIAL && fullUpdate!=EINK_REGIONAL);
     eink_cmd(0x22);
-    eink_data(fullUpdate?0xC7:0xCF);
+    eink_data(eink_mirrors_red()?0xCF:0xC7);
     eink_cmd(0x20);
+    eink_flush();
+    waveform_used(waveform);
+    profile_waveform(waveform, waveform_get_temperature());
+    for(int r=0; r<EINK_REGIONS; r++) {
+        if(full) ghosting[r] = 0;
+        else if(regionsChanged&(1<<r)) {
+            if(fullUpdate==EINK_REGIONAL) ghosting[r] = 0;
+            else if(waveform!=WAVEFORM_NONE) ghosting[r] += waveforms[waveform].ghosting;
+        }
+    }
 }
 
@@ -1,14 +1,27 @@
 #ifndef _EINK_H
 #define _EINK_H
 
+//update types. A full update below 0 is forced (on the hour for
+//instance) and always uses the full frame
+#define EINK_PARTIAL   0
+#define EINK_FULL      1
+#define EINK_REGIONAL  2   //full update waveform on the changed digits only
+
+void eink_set_light_sleep(int enable);
 void eink_start(void);
 //void eink_display_test1(void);
 //void eink_display_test2(void);
 void eink_init(int fullUpdate);
-void eink_display_number(uint8_t num, int b1, int b2, int b3, int sync, int chargeState, int fullUpdate);
+int  eink_draw_number(uint8_t num, int b1, int b2, int b3, int sync, int chargeState);
+int  eink_select_update(void);
+void eink_display_frame(int fullUpdate);
 void eink_display_setup(char *version, uint32_t ipaddress, char *ssid);
+uint32_t eink_calibrate_spi(void);
+uint32_t eink_get_spi_clock(void);
+void eink_set_spi_clock(uint32_t hz);
 void eink_update(int fullUpdate);
 void eink_stop(void);
+int  eink_sleep(void);
 void eink_shutdown_io(void);
 
 #endif
@@ -1,2318 +0,0 @@
-//Font characters 33-94
-//rotate counter clockwise
-//all caracters are aligned to the right
-//and drawing is from right to left
-//25 vertical lines and 40 pixels hight (5 bytes)
-#include <stdint.h>
-
-
-static const uint8_t char33[] = {  // "!"
-  12, 5,  // 12 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xF0, 0x00, 0x00, 0xF0, 0x7F, 
-  0xF0, 0x00, 0x00, 0xF0, 0x7F, 
-  0xF0, 0x00, 0x00, 0xF0, 0x7F, 
-  0xF0, 0x00, 0x00, 0xF0, 0x7F, 
-};
-
-static const uint8_t char34[] = {  // '"'
-  16, 5,  // 16 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char35[] = {  // "#"
-  24, 5,  // 24 vertical lines of 5 bytes
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xF1, 0xFC, 0xFF, 0xFF, 
-  0xF0, 0x11, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x01, 0xFC, 0x7F, 0xFF, 
-  0xF8, 0x00, 0x1C, 0x7F, 0xFF, 
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xF1, 0x00, 0x03, 0xFF, 
-  0xFF, 0xF1, 0xF0, 0x00, 0x7F, 
-  0xFF, 0xF1, 0xFC, 0x00, 0x7F, 
-  0xF3, 0xF1, 0xFC, 0x60, 0x7F, 
-  0xF0, 0x31, 0xFC, 0x7E, 0x7F, 
-  0xF0, 0x01, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x00, 0x7C, 0x7F, 0xFF, 
-  0xFE, 0x00, 0x04, 0x7F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xF1, 0xC0, 0x00, 0xFF, 
-  0xFF, 0xF1, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xF1, 0xFC, 0x40, 0x7F, 
-  0xFF, 0xF9, 0xFC, 0x7C, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 
-};
-
-static const uint8_t char36[] = {  // "$"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0x8F, 0xFC, 0x0F, 0xFF, 
-  0xFE, 0x0F, 0xF0, 0x03, 0xFF, 
-  0xFC, 0x0F, 0xE0, 0x01, 0xFF, 
-  0xF8, 0x0F, 0xC0, 0x00, 0xFF, 
-  0xF8, 0x3F, 0xC1, 0xE0, 0xFF, 
-  0xF0, 0x7F, 0x83, 0xF8, 0x7F, 
-  0xF0, 0xFF, 0x83, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x07, 0xFC, 0x7F, 
-  0x01, 0xFF, 0x07, 0xFC, 0x07, 
-  0x01, 0xFF, 0x0F, 0xFC, 0x07, 
-  0x01, 0xFF, 0x0F, 0xFC, 0x07, 
-  0x01, 0xFE, 0x0F, 0xFC, 0x07, 
-  0xF0, 0xFE, 0x1F, 0xF8, 0x7F, 
-  0xF0, 0xFC, 0x1F, 0xF8, 0x7F, 
-  0xF0, 0x78, 0x1F, 0xF0, 0x7F, 
-  0xF8, 0x00, 0x3F, 0xC0, 0xFF, 
-  0xFC, 0x00, 0x7E, 0x01, 0xFF, 
-  0xFE, 0x00, 0x7E, 0x03, 0xFF, 
-  0xFF, 0x81, 0xFE, 0x07, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 
-};
-
-static const uint8_t char37[] = {  // "%"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xF8, 0x01, 0xFF, 
-  0xF3, 0xFF, 0xF0, 0x00, 0xFF, 
-  0xF0, 0xFF, 0xF0, 0xF0, 0x7F, 
-  0xF0, 0x7F, 0xE3, 0xFC, 0x7F, 
-  0xF8, 0x1F, 0xE3, 0xFC, 0x7F, 
-  0xFE, 0x0F, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0x03, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0xC0, 0xF0, 0xF0, 0x7F, 
-  0xFF, 0xF0, 0x70, 0x00, 0xFF, 
-  0xFF, 0xF8, 0x18, 0x01, 0xFF, 
-  0xFF, 0xFE, 0x06, 0x07, 0xFF, 
-  0xFF, 0x07, 0x03, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xC0, 0xFF, 0xFF, 
-  0xF8, 0x00, 0xF0, 0x7F, 0xFF, 
-  0xF0, 0xF8, 0x78, 0x1F, 0xFF, 
-  0xF1, 0xFC, 0x7E, 0x07, 0xFF, 
-  0xF1, 0xFC, 0x7F, 0x83, 0xFF, 
-  0xF1, 0xFC, 0x7F, 0xC0, 0xFF, 
-  0xF1, 0xFC, 0x7F, 0xF0, 0x7F, 
-  0xF0, 0xF8, 0x7F, 0xF8, 0x7F, 
-  0xF8, 0x00, 0xFF, 0xFE, 0x7F, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char38[] = {  // "&"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xE1, 0xFE, 0x7F, 
-  0xFF, 0xFF, 0xE0, 0x78, 0x7F, 
-  0xFF, 0xFF, 0xE0, 0x10, 0x7F, 
-  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 
-  0xFF, 0x07, 0xFF, 0x01, 0xFF, 
-  0xFC, 0x01, 0xFE, 0x01, 0xFF, 
-  0xF8, 0x00, 0xFC, 0x00, 0xFF, 
-  0xF8, 0x00, 0x78, 0x10, 0xFF, 
-  0xF0, 0xF0, 0x70, 0x38, 0xFF, 
-  0xF1, 0xF8, 0x00, 0x78, 0x7F, 
-  0xF1, 0xFC, 0x01, 0xFC, 0x7F, 
-  0xF1, 0xFE, 0x03, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x07, 0xFC, 0x7F, 
-  0xF0, 0xF0, 0x0F, 0xFC, 0x7F, 
-  0xF8, 0x00, 0x07, 0xF8, 0x7F, 
-  0xF8, 0x00, 0x03, 0xF8, 0x7F, 
-  0xFC, 0x01, 0xC1, 0xE0, 0xFF, 
-  0xFF, 0x03, 0xE0, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x01, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 
-};
-
-static const uint8_t char39[] = {  // "'"
-  12, 5,  // 12 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char40[] = {  // "("
-  14, 5,  // 14 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 
-  0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 
-  0xF0, 0x03, 0xFF, 0xC0, 0x0F, 
-  0xFC, 0x00, 0x00, 0x00, 0x3F, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 
-};
-
-static const uint8_t char41[] = {  // ")"
-  14, 5,  // 14 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 
-  0xFC, 0x00, 0x00, 0x00, 0x3F, 
-  0xF0, 0x01, 0xFF, 0x80, 0x0F, 
-  0xF0, 0x1F, 0xFF, 0xF8, 0x0F, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 
-  0xF3, 0xFF, 0xFF, 0xFF, 0xCF, 
-};
-
-static const uint8_t char42[] = {  // "*"
-  18, 5,  // 18 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x1E, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0x8C, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x88, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x80, 0x7F, 0xFF, 0xFF, 
-  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x03, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x80, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0x88, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x8C, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x1E, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char43[] = {  // "+"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-};
-
-static const uint8_t char44[] = {  // ","
-  14, 5,  // 14 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x07, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x41, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x60, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x78, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
-};
-
-static const uint8_t char45[] = {  // "-"
-  16, 5,  // 16 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-};
-
-static const uint8_t char46[] = {  // "."
-  12, 5,  // 12 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-};
-
-static const uint8_t char47[] = {  // "/"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x80, 0x3F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x07, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x07, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
-};
-
-static const uint8_t char48[] = {  // "0"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFE, 0x00, 0x00, 0x03, 0xFF, 
-  0xFC, 0x07, 0xFF, 0x01, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xFC, 0x07, 0xFF, 0x01, 0xFF, 
-  0xFE, 0x00, 0x00, 0x03, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 
-};
-
-static const uint8_t char49[] = {  // "1"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 
-  0xFC, 0x1F, 0xFF, 0xFC, 0x7F, 
-  0xFE, 0x0F, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0x07, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0x83, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0x83, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC1, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xE0, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xF0, 0x7F, 0xFC, 0x7F, 
-};
-
-static const uint8_t char50[] = {  // "2"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0x00, 0x3F, 0xFC, 0x7F, 
-  0xFC, 0x00, 0x0F, 0xFC, 0x7F, 
-  0xFC, 0x00, 0x07, 0xFC, 0x7F, 
-  0xF8, 0x3E, 0x01, 0xFC, 0x7F, 
-  0xF8, 0xFF, 0x80, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xC0, 0x7C, 0x7F, 
-  0xF1, 0xFF, 0xF0, 0x3C, 0x7F, 
-  0xF1, 0xFF, 0xF8, 0x3C, 0x7F, 
-  0xF1, 0xFF, 0xFC, 0x1C, 0x7F, 
-  0xF1, 0xFF, 0xFE, 0x0C, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0x04, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0x80, 0x7F, 
-  0xF8, 0x7F, 0xFF, 0xC0, 0x7F, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0x7F, 
-  0xFC, 0x07, 0xFF, 0xF0, 0x7F, 
-  0xFE, 0x07, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0x07, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char51[] = {  // "3"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 
-  0xFF, 0x83, 0xF0, 0x07, 0xFF, 
-  0xFE, 0x01, 0xE0, 0x03, 0xFF, 
-  0xFC, 0x00, 0xC0, 0x01, 0xFF, 
-  0xF8, 0x00, 0x43, 0xC0, 0xFF, 
-  0xF8, 0x78, 0x07, 0xE0, 0xFF, 
-  0xF0, 0xFE, 0x0F, 0xF0, 0x7F, 
-  0xF0, 0xFE, 0x0F, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x1F, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x1F, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x1F, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x1F, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x1F, 0xF0, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xE0, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 
-  0xFC, 0x07, 0xFE, 0x01, 0xFF, 
-  0xFE, 0x07, 0xFE, 0x03, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x07, 0xFF, 
-  0xFF, 0xC7, 0xFE, 0x3F, 0xFF, 
-};
-
-static const uint8_t char52[] = {  // "4"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x7F, 0xFE, 0x3F, 0xFF, 
-  0xF0, 0x3F, 0xFE, 0x3F, 0xFF, 
-  0xF8, 0x0F, 0xFE, 0x3F, 0xFF, 
-  0xFE, 0x03, 0xFE, 0x3F, 0xFF, 
-  0xFF, 0x81, 0xFE, 0x3F, 0xFF, 
-  0xFF, 0xC0, 0x7E, 0x3F, 0xFF, 
-  0xFF, 0xF0, 0x3E, 0x3F, 0xFF, 
-  0xFF, 0xF8, 0x0E, 0x3F, 0xFF, 
-  0xFF, 0xFE, 0x02, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 
-};
-
-static const uint8_t char53[] = {  // "5"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 
-  0xF1, 0xFF, 0x80, 0x0F, 0xFF, 
-  0xF1, 0xFF, 0x00, 0x03, 0xFF, 
-  0xF1, 0xFE, 0x00, 0x01, 0xFF, 
-  0xF1, 0xFC, 0x0F, 0xC0, 0xFF, 
-  0xF1, 0xFC, 0x3F, 0xF0, 0xFF, 
-  0xF1, 0xF8, 0x7F, 0xF8, 0xFF, 
-  0xF1, 0xF8, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xF8, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xF8, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xF8, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xF8, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xF8, 0x7F, 
-  0xF0, 0xFC, 0x3F, 0xF8, 0x7F, 
-  0xF0, 0x02, 0x1F, 0xF0, 0xFF, 
-  0xF0, 0x00, 0x0F, 0x80, 0xFF, 
-  0xF0, 0x00, 0x0F, 0x81, 0xFF, 
-  0xFF, 0x00, 0x0F, 0x83, 0xFF, 
-  0xFF, 0xFE, 0x0F, 0x87, 0xFF, 
-};
-
-static const uint8_t char54[] = {  // "6"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 
-  0xFF, 0x1F, 0xC0, 0x07, 0xFF, 
-  0xFE, 0x1F, 0x80, 0x03, 0xFF, 
-  0xFC, 0x1F, 0x00, 0x01, 0xFF, 
-  0xF8, 0x1E, 0x07, 0xC0, 0xFF, 
-  0xF8, 0x7E, 0x1F, 0xF0, 0xFF, 
-  0xF0, 0xFC, 0x3F, 0xF8, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x7F, 0xFC, 0x7F, 
-  0xF8, 0xFE, 0x3F, 0xF8, 0x7F, 
-  0xF8, 0x7E, 0x3F, 0xF0, 0xFF, 
-  0xFC, 0x3F, 0x1F, 0xE0, 0xFF, 
-  0xFE, 0x07, 0x0F, 0x81, 0xFF, 
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 
-  0xFF, 0x80, 0x00, 0x07, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0xFF, 0xFF, 
-};
-
-static const uint8_t char55[] = {  // "7"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x03, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0x80, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xC0, 0x3F, 0xFF, 0xFF, 
-  0xF1, 0xE0, 0x0F, 0xFF, 0xFF, 
-  0xF1, 0xF8, 0x01, 0xFF, 0xFF, 
-  0xF1, 0xFE, 0x00, 0x1F, 0xFF, 
-  0xF1, 0xFF, 0x80, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xE0, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0x80, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char56[] = {  // "8"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 
-  0xFF, 0x83, 0xF8, 0x07, 0xFF, 
-  0xFE, 0x00, 0xF0, 0x03, 0xFF, 
-  0xFC, 0x00, 0x60, 0x01, 0xFF, 
-  0xFC, 0x00, 0x01, 0xE0, 0xFF, 
-  0xF8, 0x7C, 0x03, 0xF0, 0xFF, 
-  0xF8, 0xFE, 0x07, 0xF8, 0x7F, 
-  0xF0, 0xFE, 0x07, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x0F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x0F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x0F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x0F, 0xFC, 0x7F, 
-  0xF0, 0xFE, 0x07, 0xFC, 0x7F, 
-  0xF8, 0xFE, 0x07, 0xF8, 0x7F, 
-  0xF8, 0x7C, 0x03, 0xF0, 0xFF, 
-  0xF8, 0x00, 0x01, 0xE0, 0xFF, 
-  0xFC, 0x00, 0x60, 0x01, 0xFF, 
-  0xFE, 0x00, 0xF0, 0x01, 0xFF, 
-  0xFF, 0x83, 0xF8, 0x07, 0xFF, 
-  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 
-};
-
-static const uint8_t char57[] = {  // "9"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0x00, 0x00, 0x0F, 0xFF, 
-  0xFE, 0x00, 0x00, 0x07, 0xFF, 
-  0xFC, 0x0F, 0x0F, 0x03, 0xFF, 
-  0xF8, 0x3F, 0x8F, 0xC1, 0xFF, 
-  0xF8, 0xFF, 0xC7, 0xF0, 0xFF, 
-  0xF0, 0xFF, 0xC7, 0xF8, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xE3, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xE3, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xE3, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xE3, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xC3, 0xF8, 0x7F, 
-  0xF8, 0x7F, 0x87, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0x07, 0xC0, 0xFF, 
-  0xFC, 0x00, 0x0F, 0x81, 0xFF, 
-  0xFE, 0x00, 0x0F, 0x83, 0xFF, 
-  0xFF, 0x00, 0x3F, 0x87, 0xFF, 
-  0xFF, 0xC0, 0xFF, 0xBF, 0xFF, 
-};
-
-static const uint8_t char58[] = {  // ":"
-  12, 5,  // 12 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 
-  0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 
-  0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 
-  0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 
-  0xFF, 0xF8, 0x3F, 0xF0, 0x7F, 
-};
-
-static const uint8_t char59[] = {  // ";"
-  14, 5,  // 14 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 
-  0xFF, 0xF0, 0x7F, 0xF0, 0x07, 
-  0xFF, 0xF0, 0x7F, 0xF0, 0x00, 
-  0xFF, 0xF0, 0x7F, 0xF0, 0x60, 
-  0xFF, 0xF0, 0x7F, 0xF0, 0x78, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
-};
-
-static const uint8_t char60[] = {  // "<"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0x87, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0x87, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0x87, 0xFF, 
-  0xFF, 0xF8, 0xFF, 0x0F, 0xFF, 
-  0xFF, 0xF8, 0x7F, 0x0F, 0xFF, 
-  0xFF, 0xF8, 0x7F, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x7E, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x3E, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x3E, 0x3F, 0xFF, 
-  0xFF, 0xFE, 0x1C, 0x3F, 0xFF, 
-  0xFF, 0xFE, 0x1C, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x18, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x08, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-};
-
-static const uint8_t char61[] = {  // "="
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-  0xFF, 0xFE, 0x3F, 0x1F, 0xFF, 
-};
-
-static const uint8_t char62[] = {  // ">"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x08, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x08, 0x7F, 0xFF, 
-  0xFF, 0xFE, 0x1C, 0x7F, 0xFF, 
-  0xFF, 0xFE, 0x1C, 0x3F, 0xFF, 
-  0xFF, 0xFE, 0x3C, 0x3F, 0xFF, 
-  0xFF, 0xFC, 0x3E, 0x3F, 0xFF, 
-  0xFF, 0xFC, 0x3E, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x7E, 0x1F, 0xFF, 
-  0xFF, 0xF8, 0x7F, 0x0F, 0xFF, 
-  0xFF, 0xF8, 0x7F, 0x0F, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0x8F, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0x87, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0x87, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 
-};
-
-static const uint8_t char63[] = {  // "?"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0x81, 0xFF, 0xFF, 0xFF, 
-  0xFE, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFC, 0x00, 0x3F, 0xFF, 0xFF, 
-  0xF8, 0x00, 0x1F, 0xFF, 0xFF, 
-  0xF8, 0x3C, 0x0F, 0xFF, 0xFF, 
-  0xF8, 0xFF, 0x0F, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0x07, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x83, 0xF0, 0x7F, 
-  0xF1, 0xFF, 0xC0, 0x70, 0x7F, 
-  0xF1, 0xFF, 0xE0, 0x70, 0x7F, 
-  0xF1, 0xFF, 0xF0, 0x70, 0x7F, 
-  0xF1, 0xFF, 0xF8, 0x70, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xFC, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFE, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char64[] = {  // "@"
-  24, 5,  // 24 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x07, 0xFF, 
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 
-  0xFE, 0x01, 0xFF, 0xC1, 0xFF, 
-  0xFC, 0x0F, 0xFF, 0xF1, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xF1, 0xF9, 
-  0xF8, 0x7C, 0x00, 0x01, 0xF8, 
-  0xF8, 0xFC, 0x00, 0x01, 0xF8, 
-  0xF0, 0xFC, 0x00, 0x01, 0xF8, 
-  0xF1, 0xFF, 0x1F, 0x87, 0xF8, 
-  0xF1, 0xFE, 0x3F, 0xC3, 0xF8, 
-  0xF1, 0xFC, 0x7F, 0xE1, 0xF8, 
-  0xF1, 0xFC, 0x7F, 0xE1, 0xF8, 
-  0xF1, 0xFC, 0x3F, 0xC1, 0xF8, 
-  0xF8, 0xFC, 0x1F, 0x81, 0xF0, 
-  0xF8, 0x7E, 0x00, 0x03, 0xE1, 
-  0xF8, 0x3F, 0x00, 0x07, 0xC1, 
-  0xFC, 0x1F, 0xE0, 0x3F, 0x83, 
-  0xFE, 0x07, 0xFF, 0xFE, 0x07, 
-  0xFF, 0x00, 0xFF, 0xF0, 0x0F, 
-  0xFF, 0x80, 0x00, 0x00, 0x1F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x3F, 
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 
-};
-
-static const uint8_t char65[] = {  // "A"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0x80, 0x00, 0x7F, 0xFF, 
-  0xF8, 0x00, 0x0C, 0x7F, 0xFF, 
-  0xF0, 0x00, 0x7C, 0x7F, 0xFF, 
-  0xF0, 0x07, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x7F, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x7F, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x07, 0xFC, 0x7F, 0xFF, 
-  0xF0, 0x00, 0x7C, 0x7F, 0xFF, 
-  0xF8, 0x00, 0x0C, 0x7F, 0xFF, 
-  0xFF, 0x80, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 
-};
-
-static const uint8_t char66[] = {  // "B"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0x83, 0xFC, 0x0F, 0xFF, 
-  0xFE, 0x00, 0xF0, 0x03, 0xFF, 
-  0xFC, 0x00, 0x60, 0x01, 0xFF, 
-  0xF8, 0x00, 0x40, 0x01, 0xFF, 
-  0xF8, 0x3C, 0x01, 0xE0, 0xFF, 
-  0xF0, 0xFF, 0x07, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0x07, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char67[] = {  // "C"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0x87, 0xFE, 0x0F, 0xFF, 
-  0xFF, 0x07, 0xFE, 0x07, 0xFF, 
-  0xFE, 0x07, 0xFE, 0x03, 0xFF, 
-  0xFC, 0x07, 0xFE, 0x01, 0xFF, 
-  0xF8, 0x1F, 0xFF, 0xC0, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 
-  0xFE, 0x03, 0xFE, 0x03, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-};
-
-static const uint8_t char68[] = {  // "D"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFE, 0x03, 0xFE, 0x03, 0xFF, 
-  0xFC, 0x0F, 0xFF, 0x81, 0xFF, 
-  0xFC, 0x3F, 0xFF, 0xE1, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char69[] = {  // "E"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char70[] = {  // "F"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char71[] = {  // "G"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xE7, 0xC0, 0x07, 0xFF, 
-  0xFF, 0x87, 0xC0, 0x03, 0xFF, 
-  0xFE, 0x07, 0xC0, 0x01, 0xFF, 
-  0xFC, 0x07, 0xC0, 0x01, 0xFF, 
-  0xFC, 0x07, 0xC7, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0xC7, 0xF0, 0xFF, 
-  0xF8, 0x7F, 0xC7, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0xC7, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xC7, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 
-  0xFE, 0x03, 0xFE, 0x03, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-};
-
-static const uint8_t char72[] = {  // "H"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char73[] = {  // "I"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char74[] = {  // "J"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x03, 0xFF, 
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char75[] = {  // "K"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xF7, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xF0, 0x7F, 0xFF, 0x80, 0x7F, 
-  0xF0, 0x3F, 0xFE, 0x01, 0xFF, 
-  0xF8, 0x1F, 0xFC, 0x03, 0xFF, 
-  0xFC, 0x0F, 0xF0, 0x0F, 0xFF, 
-  0xFE, 0x07, 0xE0, 0x1F, 0xFF, 
-  0xFF, 0x03, 0x80, 0x7F, 0xFF, 
-  0xFF, 0x80, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xFE, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char76[] = {  // "L"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char77[] = {  // "M"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x0F, 0xFF, 0xFF, 
-  0xFE, 0x00, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0x80, 0x7F, 
-  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 
-  0xFF, 0xFC, 0x00, 0x01, 0xFF, 
-  0xFF, 0x80, 0x00, 0x3F, 0xFF, 
-  0xF0, 0x00, 0x03, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x07, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0x80, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-};
-
-static const uint8_t char78[] = {  // "N"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char79[] = {  // "O"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFE, 0x00, 0x00, 0x07, 0xFF, 
-  0xFC, 0x03, 0xFE, 0x03, 0xFF, 
-  0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 
-  0xFC, 0x03, 0xFE, 0x01, 0xFF, 
-  0xFE, 0x00, 0x00, 0x03, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 
-};
-
-static const uint8_t char80[] = {  // "P"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x3F, 0xFF, 0xFF, 
-  0xFE, 0x00, 0x1F, 0xFF, 0xFF, 
-  0xFC, 0x00, 0x0F, 0xFF, 0xFF, 
-  0xF8, 0x3E, 0x07, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0x87, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xE3, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char81[] = {  // "Q"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xFC, 0x01, 0xFC, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x3C, 0x7F, 
-  0xFF, 0x80, 0x00, 0x0C, 0x7F, 
-  0xFF, 0x00, 0x00, 0x04, 0x7F, 
-  0xFE, 0x03, 0xFE, 0x02, 0x7F, 
-  0xFC, 0x1F, 0xFF, 0xC0, 0x7F, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0x7F, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 
-  0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 
-  0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 
-  0xFE, 0x03, 0xFE, 0x03, 0xFF, 
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-};
-
-static const uint8_t char82[] = {  // "R"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0x81, 0xFF, 0xFE, 0x7F, 
-  0xFE, 0x00, 0x7F, 0xF0, 0x7F, 
-  0xFC, 0x00, 0x3F, 0xC0, 0x7F, 
-  0xFC, 0x00, 0x1F, 0x00, 0x7F, 
-  0xF8, 0x3E, 0x0E, 0x01, 0xFF, 
-  0xF8, 0xFF, 0x0C, 0x0F, 0xFF, 
-  0xF0, 0xFF, 0x80, 0x1F, 0xFF, 
-  0xF1, 0xFF, 0xC0, 0x7F, 0xFF, 
-  0xF1, 0xFF, 0xC0, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char83[] = {  // "S"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xCF, 0xF8, 0x0F, 0xFF, 
-  0xFF, 0x0F, 0xF0, 0x07, 0xFF, 
-  0xFE, 0x0F, 0xE0, 0x03, 0xFF, 
-  0xFC, 0x0F, 0xC0, 0x01, 0xFF, 
-  0xF8, 0x3F, 0x81, 0xF0, 0xFF, 
-  0xF8, 0x7F, 0x83, 0xF8, 0xFF, 
-  0xF0, 0xFF, 0x83, 0xF8, 0x7F, 
-  0xF1, 0xFF, 0x07, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x07, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x07, 0xFC, 0x7F, 
-  0xF1, 0xFE, 0x0F, 0xFC, 0x7F, 
-  0xF1, 0xFE, 0x0F, 0xFC, 0x7F, 
-  0xF0, 0xFE, 0x0F, 0xF8, 0x7F, 
-  0xF8, 0xFC, 0x1F, 0xF8, 0x7F, 
-  0xF8, 0x78, 0x1F, 0xF0, 0xFF, 
-  0xFC, 0x00, 0x3F, 0xC0, 0xFF, 
-  0xFC, 0x00, 0x3E, 0x01, 0xFF, 
-  0xFE, 0x00, 0x7E, 0x03, 0xFF, 
-  0xFF, 0x81, 0xFE, 0x07, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 
-};
-
-static const uint8_t char84[] = {  // "T"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char85[] = {  // "U"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xF0, 0x00, 0x00, 0x3F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x03, 0xFF, 
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 
-  0xF0, 0x00, 0x00, 0x03, 0xFF, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x3F, 0xFF, 
-};
-
-static const uint8_t char86[] = {  // "V"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x3F, 0xFF, 0xFF, 
-  0xFE, 0x00, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xF0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x7F, 0xFF, 
-  0xFE, 0x00, 0x03, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x3F, 0xFF, 0xFF, 
-  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char87[] = {  // "W"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xF0, 0x00, 0x03, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x80, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x00, 0x00, 0xFF, 
-  0xFC, 0x00, 0x00, 0x3F, 0xFF, 
-  0xF0, 0x00, 0x0F, 0xFF, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x03, 0xFF, 0xFF, 
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xF0, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xFF, 0xC0, 0x00, 0x7F, 
-  0xFF, 0x80, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFF, 
-  0xF0, 0x00, 0x1F, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char88[] = {  // "X"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 
-  0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 
-  0xF0, 0x0F, 0xFF, 0x00, 0x7F, 
-  0xF8, 0x03, 0xFE, 0x01, 0xFF, 
-  0xFE, 0x01, 0xF8, 0x07, 0xFF, 
-  0xFF, 0x80, 0x60, 0x1F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0x80, 0x60, 0x0F, 0xFF, 
-  0xFE, 0x01, 0xF8, 0x07, 0xFF, 
-  0xF8, 0x03, 0xFE, 0x01, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0x00, 0x7F, 
-  0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 
-  0xF0, 0x7F, 0xFF, 0xF0, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF7, 0xFF, 0xFF, 0xFE, 0x7F, 
-};
-
-static const uint8_t char89[] = {  // "Y"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF8, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char90[] = {  // "Z"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x7F, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x0F, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x07, 0xFF, 0xFC, 0x7F, 
-  0xF0, 0x01, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0x80, 0xFF, 0xFC, 0x7F, 
-  0xF1, 0xC0, 0x3F, 0xFC, 0x7F, 
-  0xF1, 0xE0, 0x1F, 0xFC, 0x7F, 
-  0xF1, 0xF8, 0x0F, 0xFC, 0x7F, 
-  0xF1, 0xFC, 0x03, 0xFC, 0x7F, 
-  0xF1, 0xFE, 0x01, 0xFC, 0x7F, 
-  0xF1, 0xFF, 0x80, 0x7C, 0x7F, 
-  0xF1, 0xFF, 0xC0, 0x3C, 0x7F, 
-  0xF1, 0xFF, 0xF0, 0x0C, 0x7F, 
-  0xF1, 0xFF, 0xF8, 0x04, 0x7F, 
-  0xF1, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0x00, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0x80, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xE0, 0x7F, 
-  0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char91[] = {  // "["
-  14, 5,  // 14 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-};
-
-static const uint8_t char92[] = {  // "\"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x07, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x07, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 
-  0xFF, 0xFF, 0xFF, 0x80, 0x3F, 
-  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xFC, 0x01, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x07, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char93[] = {  // "]"
-  16, 5,  // 16 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-};
-
-static const uint8_t char94[] = {  // "^"
-  18, 5,  // 18 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xFC, 0x03, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 
-  0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
-  0xFC, 0x03, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 
-};
-
-static const uint8_t char95[] = {  // "_"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 
-};
-
-static const uint8_t char96[] = {  // "`"
-  13, 5,  // 13 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x83, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char97[] = {  // "a"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0xE3, 0xC3, 0xFF, 
-  0xFF, 0xE3, 0xE3, 0xE1, 0xFF, 
-  0xFF, 0xC3, 0xE3, 0xF0, 0xFF, 
-  0xFF, 0xC7, 0xE3, 0xF8, 0xFF, 
-  0xFF, 0xC7, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE3, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE1, 0xFC, 0x7F, 
-  0xFF, 0xC3, 0xF1, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xF0, 0xF0, 0x7F, 
-  0xFF, 0xE0, 0xF0, 0x00, 0xFF, 
-  0xFF, 0xF0, 0x78, 0x00, 0xFF, 
-  0xFF, 0xF8, 0x7C, 0x01, 0xFF, 
-  0xFF, 0xFC, 0x7F, 0x07, 0xFF, 
-  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 
-};
-
-static const uint8_t char98[] = {  // "b"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xF0, 0x7F, 0xC3, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char99[] = {  // "c"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFC, 0x3F, 0x87, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0x83, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-};
-
-static const uint8_t char100[] = {  // "d"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x7F, 0xC3, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-};
-
-static const uint8_t char101[] = {  // "e"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFF, 0x07, 0x8F, 0xFF, 
-  0xFF, 0xFC, 0x07, 0x83, 0xFF, 
-  0xFF, 0xF0, 0x07, 0x81, 0xFF, 
-  0xFF, 0xF0, 0x07, 0x81, 0xFF, 
-  0xFF, 0xE0, 0xC7, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xC7, 0xF8, 0xFF, 
-  0xFF, 0xC3, 0xC7, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xC7, 0xFC, 0x7F, 
-  0xFF, 0xC3, 0xC7, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xC7, 0xF0, 0xFF, 
-  0xFF, 0xE0, 0xC7, 0xE0, 0xFF, 
-  0xFF, 0xF0, 0x07, 0x81, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-};
-
-static const uint8_t char102[] = {  // "f"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0x8F, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x8F, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x87, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0x87, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xC0, 0x00, 0x00, 0x00, 0x7F, 
-  0xC0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xF8, 0x00, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char103[] = {  // "g"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xC0, 0x00, 0x00, 0x3F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x0F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x07, 
-  0xFF, 0xC0, 0x00, 0x00, 0x03, 
-  0xFF, 0xF8, 0x7F, 0x0F, 0x81, 
-  0xFF, 0xF1, 0xFF, 0xC7, 0xE1, 
-  0xFF, 0xE3, 0xFF, 0xE3, 0xF1, 
-  0xFF, 0xE3, 0xFF, 0xE3, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xF1, 0xF8, 
-  0xFF, 0xC3, 0xFF, 0xE1, 0xF8, 
-  0xFF, 0xE3, 0xFF, 0xE3, 0xF0, 
-  0xFF, 0xE1, 0xFF, 0xC3, 0xE1, 
-  0xFF, 0xE0, 0x7F, 0x03, 0x81, 
-  0xFF, 0xF0, 0x00, 0x07, 0x83, 
-  0xFF, 0xF8, 0x00, 0x0F, 0x83, 
-  0xFF, 0xFE, 0x00, 0x3F, 0x8F, 
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 
-};
-
-static const uint8_t char104[] = {  // "h"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char105[] = {  // "i"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xC3, 0xC0, 0x00, 0x00, 0x7F, 
-  0xC3, 0xC0, 0x00, 0x00, 0x7F, 
-  0xC3, 0xC0, 0x00, 0x00, 0x7F, 
-  0xC3, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char106[] = {  // "j"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xC3, 0xC0, 0x00, 0x00, 0x0F, 
-  0xC3, 0xC0, 0x00, 0x00, 0x03, 
-  0xC3, 0xC0, 0x00, 0x00, 0x01, 
-  0xC3, 0xC0, 0x00, 0x00, 0x01, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 
-};
-
-static const uint8_t char107[] = {  // "k"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFF, 0xDF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xCF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0x80, 0x7F, 
-  0xFF, 0xC1, 0xFE, 0x00, 0xFF, 
-  0xFF, 0xE0, 0xF8, 0x03, 0xFF, 
-  0xFF, 0xF0, 0x70, 0x0F, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xFE, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char108[] = {  // "l"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 
-  0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char109[] = {  // "m"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char110[] = {  // "n"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF8, 0x00, 0x00, 0x7F, 
-  0xFF, 0xF0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char111[] = {  // "o"
-  22, 5,  // 22 vertical lines of 5 bytes
-  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 
-};
-
-static const uint8_t char112[] = {  // "p"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xF8, 0x7F, 0xC1, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-};
-
-static const uint8_t char113[] = {  // "q"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0xFF, 0xF8, 0x7F, 0xC3, 0xFF, 
-  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xF0, 0x3F, 0x81, 0xFF, 
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x07, 0xFF, 
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 
-};
-
-static const uint8_t char114[] = {  // "r"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-};
-
-static const uint8_t char115[] = {  // "s"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xFE, 0x7F, 0x07, 0xFF, 
-  0xFF, 0xF8, 0x7C, 0x03, 0xFF, 
-  0xFF, 0xF0, 0x7C, 0x01, 0xFF, 
-  0xFF, 0xE0, 0x78, 0x00, 0xFF, 
-  0xFF, 0xE1, 0xF8, 0x70, 0xFF, 
-  0xFF, 0xE3, 0xF0, 0xF8, 0x7F, 
-  0xFF, 0xC3, 0xF0, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xF0, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xF1, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE1, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE1, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE1, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE1, 0xF8, 0x7F, 
-  0xFF, 0xC3, 0xC3, 0xF0, 0xFF, 
-  0xFF, 0xE1, 0xC3, 0xE0, 0xFF, 
-  0xFF, 0xE0, 0x03, 0x81, 0xFF, 
-  0xFF, 0xF0, 0x07, 0x81, 0xFF, 
-  0xFF, 0xF8, 0x0F, 0x83, 0xFF, 
-  0xFF, 0xFC, 0x1F, 0x8F, 0xFF, 
-};
-
-static const uint8_t char116[] = {  // "t"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xF8, 0x7F, 
-  0xF0, 0x00, 0x00, 0x00, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0xFF, 
-  0xF8, 0x00, 0x00, 0x01, 0xFF, 
-  0xF8, 0x00, 0x00, 0x07, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char117[] = {  // "u"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0x83, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x00, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x01, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 
-};
-
-static const uint8_t char118[] = {  // "v"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x03, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xF8, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char119[] = {  // "w"
-  23, 5,  // 23 vertical lines of 5 bytes
-  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x80, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xFF, 0xFC, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x80, 0x00, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xC0, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x01, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 
-  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-};
-
-static const uint8_t char120[] = {  // "x"
-  20, 5,  // 20 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 
-  0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xC1, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xE0, 0x3F, 0x01, 0xFF, 
-  0xFF, 0xF8, 0x0E, 0x03, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xF8, 0x0E, 0x03, 0xFF, 
-  0xFF, 0xE0, 0x3F, 0x01, 0xFF, 
-  0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 
-  0xFF, 0xC1, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xC3, 0xFF, 0xF8, 0x7F, 
-  0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 
-};
-
-static const uint8_t char121[] = {  // "y"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xF0, 0x03, 0xFF, 0xFF, 
-  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 
-  0xFF, 0xFF, 0x80, 0x1F, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 
-  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x80, 0x3F, 
-  0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x03, 
-  0xFF, 0xFF, 0xF8, 0x00, 0x01, 
-  0xFF, 0xFF, 0xC0, 0x07, 0xC1, 
-  0xFF, 0xFF, 0x00, 0x3F, 0xE0, 
-  0xFF, 0xFC, 0x00, 0xFF, 0xF0, 
-  0xFF, 0xE0, 0x07, 0xFF, 0xF8, 
-  0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 
-  0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 
-  0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 
-  0xFF, 0xCF, 0xFF, 0xFF, 0xF8, 
-};
-
-static const uint8_t char122[] = {  // "z"
-  19, 5,  // 19 vertical lines of 5 bytes
-  0xFF, 0xC7, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC1, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 
-  0xFF, 0xC0, 0x7F, 0xFC, 0x7F, 
-  0xFF, 0xC0, 0x3F, 0xFC, 0x7F, 
-  0xFF, 0xC4, 0x0F, 0xFC, 0x7F, 
-  0xFF, 0xC6, 0x07, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0x03, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0x81, 0xFC, 0x7F, 
-  0xFF, 0xC7, 0xE0, 0x7C, 0x7F, 
-  0xFF, 0xC7, 0xF0, 0x3C, 0x7F, 
-  0xFF, 0xC7, 0xF8, 0x1C, 0x7F, 
-  0xFF, 0xC7, 0xFC, 0x0C, 0x7F, 
-  0xFF, 0xC7, 0xFE, 0x00, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0x80, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xC0, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xE0, 0x7F, 
-  0xFF, 0xC7, 0xFF, 0xF0, 0x7F, 
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 
-};
-
-static const uint8_t char123[] = {  // "{"
-  16, 5,  // 16 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 
-  0xF0, 0x7F, 0xFF, 0xFE, 0x0F, 
-  0xF8, 0x00, 0x7E, 0x00, 0x1F, 
-  0xFC, 0x00, 0x18, 0x00, 0x1F, 
-  0xFE, 0x00, 0x00, 0x00, 0x3F, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-};
-
-static const uint8_t char124[] = {  // "|"
-  12, 5,  // 12 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 
-};
-
-static const uint8_t char125[] = {  // "}"
-  16, 5,  // 16 vertical lines of 5 bytes
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 
-  0xFE, 0x00, 0x00, 0x00, 0x3F, 
-  0xFC, 0x00, 0x18, 0x00, 0x1F, 
-  0xF8, 0x00, 0x7E, 0x00, 0x1F, 
-  0xF0, 0x7F, 0xFF, 0xFE, 0x0F, 
-  0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-  0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 
-};
-
-static const uint8_t char126[] = {  // "~"
-  21, 5,  // 21 vertical lines of 5 bytes
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 
-};
-
-const uint8_t *font[] = {
-  char33, // "!"
-  char34, // """
-  char35, // "#"
-  char36, // "$"
-  char37, // "%"
-  char38, // "&"
-  char39, // "'"
-  char40, // "("
-  char41, // ")"
-  char42, // "*"
-  char43, // "+"
-  char44, // ","
-  char45, // "-"
-  char46, // "."
-  char47, // "/"
-  char48, // "0"
-  char49, // "1"
-  char50, // "2"
-  char51, // "3"
-  char52, // "4"
-  char53, // "5"
-  char54, // "6"
-  char55, // "7"
-  char56, // "8"
-  char57, // "9"
-  char58, // ":"
-  char59, // ";"
-  char60, // "<"
-  char61, // "="
-  char62, // ">"
-  char63, // "?"
-  char64, // "@"
-  char65, // "A"
-  char66, // "B"
-  char67, // "C"
-  char68, // "D"
-  char69, // "E"
-  char70, // "F"
-  char71, // "G"
-  char72, // "H"
-  char73, // "I"
-  char74, // "J"
-  char75, // "K"
-  char76, // "L"
-  char77, // "M"
-  char78, // "N"
-  char79, // "O"
-  char80, // "P"
-  char81, // "Q"
-  char82, // "R"
-  char83, // "S"
-  char84, // "T"
-  char85, // "U"
-  char86, // "V"
-  char87, // "W"
-  char88, // "X"
-  char89, // "Y"
-  char90, // "Z"
-  char91, // "["
-  char92, // "\"
-  char93, // "]"
-  char94, // "^"
-  char95, // "_"
-  char96, // "`"
-  char97, // "a"
-  char98, // "b"
-  char99, // "c"
-  char100, // "d"
-  char101, // "e"
-  char102, // "f"
-  char103, // "g"
-  char104, // "h"
-  char105, // "i"
-  char106, // "j"
-  char107, // "k"
-  char108, // "l"
-  char109, // "m"
-  char110, // "n"
-  char111, // "o"
-  char112, // "p"
-  char113, // "q"
-  char114, // "r"
-  char115, // "s"
-  char116, // "t"
-  char117, // "u"
-  char118, // "v"
-  char119, // "w"
-  char120, // "x"
-  char121, // "y"
-  char122, // "z"
-  char123, // "{"
-  char124, // "|"
-  char125, // "}"
-  char126, // "~"
-};
@@ -12,7 +12,7 @@
 #include "esp_log.h"
 #include "esp_attr.h"
 #include "esp_sleep.h"
-#include "nvs_flash.h"
+#include "storage.h"
 #include "esp_sntp.h"
 #include "wifi.h"
 #include "eink.h"
@@ -23,6 +23,7 @@
 
 #include "rotate.h"
 #include "charger.h"
+#include "profile.h"
 
 #include "ulp_utils.h"
 
@@ -39,7 +40,6 @@ static const char *TAG = "hourglassclock";
  */
 RTC_NOINIT_ATTR int    crashCount;
 RTC_NOINIT_ATTR int    syncCrashed;
-RTC_NOINIT_ATTR int    lastChargerState;
 RTC_NOINIT_ATTR int    coldStart;
 RTC_NOINIT_ATTR time_t lastSyncTime;
 
@@ -61,15 +61,9 @@ void time_sync_notification_cb(struct timeval *tv)
     ESP_LOGI(TAG, "Notification of a time synchronization event");
 }
 
-static uint64_t millis() {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (tv.tv_sec * 1000ULL + (tv.tv_usec / 1000ULL));
-}
-
 void app_main(void)
 {
-    uint64_t wakeuptime = millis();
+    profile_start();
     int crashDetect=0;
     ++boot_count;
     esp_reset_reason_t resetReason = esp_reset_reason();
@@ -88,7 +82,6 @@ void app_main(void)
        //normal reset. Reset crash counter
        crashCount=0;
        lastSyncTime=0;
-       lastChargerState=-1;
        coldStart=-1;
     } else {
        //unexpected reset. increment crash counter
@@ -96,8 +89,6 @@ void app_main(void)
        crashDetect=1;
     }
 
-    ESP_ERROR_CHECK( nvs_flash_init() );
-
     //Check wakeup reason. When EXT1, switch to management mode
     //Can't do this on connecting the charger because it would
     //wakeup continuously af long as the charger is connected
@@ -137,7 +128,9 @@ void app_main(void)
     if(doSync) {
         syncCrashed = 1;
         ESP_LOGI(TAG, "Time sync required. Connecting to WiFi and getting time over NTP.");
+        profile_phase(PROFILE_SYNC);
         obtain_time();
+        profile_phase(PROFILE_APP);
         //When we get here time sync did not crash
         //but if it's immediately after a brownout, still indicate the crash
         if(!crashDetect) syncCrashed = 0;
@@ -158,7 +151,9 @@ void app_main(void)
         doRotate=1;
         fullUpdate=-1;
     }
+#if defined(CONFIG_EINK_GHOST_BUDGET) && CONFIG_EINK_GHOST_BUDGET==0
     if(!fullUpdate && (minutes%10)==0) fullUpdate=1;
+#endif
     
     battery_info_t *battery_info;
     if(crashDetect) doRotate=0; //don't turn on motors after unexpected reset
@@ -184,8 +179,10 @@ void app_main(void)
         if(hour==0) hour=12;
 
         //get battery voltages and charger state (twice, first old, then new)
+        profile_phase(PROFILE_CHARGER);
         battery_info=charger_get_battery_state();
         battery_info=charger_get_battery_state();
+        profile_phase(PROFILE_APP);
         //check battery levels OK
         if((battery_info->b2>=0)
           &&((battery_info->mode)||(battery_info->b3>=0))) {
@@ -196,7 +193,9 @@ void app_main(void)
         }
     } else {
         //get current charger status
+        profile_phase(PROFILE_CHARGER);
         battery_info=charger_enabled_state();
+        profile_phase(PROFILE_APP);
     }
     //change charger icon for 3 battery mode 
     //(i.e. 2 icons showing) when charging
@@ -204,39 +203,48 @@ void app_main(void)
     if(battery_info->mode && chargerState==1) chargerState=4;
     ESP_LOGI(TAG, "Charger state: %d\n",battery_info->state);
 
-    //start updating the eink display
-    uint64_t startEink=millis()-wakeuptime;
-    eink_start();
-    eink_init(fullUpdate);
-    if(!fullUpdate && lastChargerState==chargerState) {
-        //not a full display update and charger state has not changed
-        //so no need to update
-        chargerState=-1; 
-    } else {
-        //remember current chargerState for next run
-        lastChargerState = chargerState;
-    }
     int syncState = 3; //Sync is too long ago
     if((now-4*86400)<lastSyncTime) syncState = (int)((now-lastSyncTime)/86400);
     if(syncCrashed) syncState+=4; //reboot during time sync. Show on display
-    eink_display_number(minutes,
+    profile_phase(PROFILE_EINK_DRAW);
+    int displayChanged = eink_draw_number(minutes,
                         //b1: battery for EPS32 (right symbol)
                         //when detecting low level and sync crashed, it's dead!
                         (syncCrashed&&battery_info->b1==0)?-1: battery_info->b1,
                         battery_info->b2,  //battery for Motor1 or both (left)
                         battery_info->b3,  //battery for none or Motor2 (center)
                         syncState,
-                        chargerState,
-                        fullUpdate);
-    uint64_t displayEink=millis()-wakeuptime;
-    eink_update(fullUpdate);
-    uint64_t updateEink=millis()-wakeuptime;
+                        chargerState);
+    //full or regional full update when the partial updates left
+    //too much ghosting behind
+    if(!fullUpdate && displayChanged) fullUpdate=eink_select_update();
+    if(displayChanged) {
+        //start updating the eink display
+        profile_phase(PROFILE_EINK_START);
+        //the rings are positioned by tasks that have to keep
+        //running. Only sleep while waiting when they don't rotate
+        eink_set_light_sleep(!doRotate);
+        //after a reset the SPI clock of the display comes from NVS.
+        //Setup mode calibrates it, till then the default clock is used
+        if(!eink_get_spi_clock()) eink_set_spi_clock(storage_get_u32(STORAGE_EINK_SPI_CLOCK, 0));
+        eink_start();
+        profile_phase(PROFILE_EINK_INIT);
+        eink_init(fullUpdate);
+        profile_phase(PROFILE_EINK_DRAW);
+        eink_display_frame(fullUpdate);
+        eink_update(fullUpdate);
+    } else {
+        //display already shows this screen. Leave it asleep
+        ESP_LOGI(TAG, "Display unchanged");
+        profile_display_skipped();
+    }
+    profile_phase(PROFILE_APP);
 
     if(doRotate) {
         //wait till rotating the rings is done
-        while(rotate_busy()) {
-            vTaskDelay(50 / portTICK_PERIOD_MS);
-        }
+        profile_phase(PROFILE_ROTATE);
+        rotate_wait();
+        profile_phase(PROFILE_APP);
         //free charger module
         charger_free();
     }
@@ -244,9 +252,7 @@ void app_main(void)
     //wait for eink update to complete
     //TODO: wait for eink update completion using ULP
     //eink_stop();
-    uint64_t stopEink=millis()-wakeuptime;
     //eink_shutdown_io();
-    uint64_t shutdownEink=millis()-wakeuptime;
     
     if(boot_count==1) {
         //We've made a full run updating the display
@@ -265,15 +271,16 @@ void app_main(void)
     //configure managment gpio pin to wakeup from deep sleep
     esp_sleep_enable_ext1_wakeup(0x8000000000, ESP_EXT1_WAKEUP_ALL_LOW);
 
+    profile_phase(PROFILE_SLEEP);
     time(&now);
     long deep_sleep_sec = 60-(now%60);
     if(deep_sleep_sec<3) deep_sleep_sec+=60L;
-    ESP_LOGI(TAG, "Entering deep sleep for %ld seconds (%d,%d,%d,%d,%d,%d)", deep_sleep_sec, (int)startEink, (int)displayEink, (int)updateEink, (int)stopEink, (int)shutdownEink, (int)(millis()-wakeuptime));
+    ESP_LOGI(TAG, "Entering deep sleep for %ld seconds", deep_sleep_sec);
 
     //TODO: Refactor this section
     //Initialize RTC_IO for the eink display to allow the ULP to
     //bring the eink display into deep sleep mode
-    if(gpio_get_level(GPIO_NUM_4)) {
+    if(displayChanged && eink_sleep()) {
         //eink display is still busy. Let ULP handle eink power down
         eink_shutdown_io();
         rtc_gpio_init(GPIO_NUM_4);
@@ -300,6 +307,12 @@ void app_main(void)
         ESP_LOGW(TAG, "ULP not started");
     }
 
+    //cycle type for the profiler
+    int cycle = PROFILE_CYCLE_PARTIAL;
+    if(doSync) cycle = PROFILE_CYCLE_SYNC;
+    else if(doRotate) cycle = PROFILE_CYCLE_ROTATE;
+    else if(fullUpdate) cycle = PROFILE_CYCLE_FULL;
+    profile_sleep(cycle, deep_sleep_sec*1000000l);
     esp_deep_sleep(deep_sleep_sec*1000000l);
 }
 
@@ -307,6 +320,8 @@ static void obtain_time(void)
 {
     //TODO: determine time correction factor for the RTC
     //      to compensate for the error in the 32KHz xtal frequency
+    //wifi configuration and the wifi driver need NVS
+    ESP_ERROR_CHECK( storage_init() );
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK( esp_event_loop_create_default() );
 
@@ -0,0 +1,209 @@
+/* profile.c
+ * Measures where the active time of every wake goes.
+ * The time of a wake is split over phases (see profile.h). Only one
+ * phase is active at a time so nested code (SPI transfers inside
+ * eink_init for instance) is taken out of the enclosing phase.
+ * The statistics are kept in RTC memory so they survive deep sleep.
+ * They can be retrieved through /info.json in setup mode.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include "esp_system.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "profile.h"
+#include "waveform.h"
+
+#define PROFILE_HIST     16  //histogram buckets of the active time
+#define PROFILE_RECENT    8  //last wakes kept in detail
+
+typedef struct {
+    uint32_t count;
+    uint32_t displaySkipped;         //wakes without a display update
+    uint32_t min[PROFILE_PHASES+1];  //last entry is the total
+    uint32_t max[PROFILE_PHASES+1];
+    uint64_t sum[PROFILE_PHASES+1];
+    uint16_t hist[PROFILE_HIST];
+} profile_stats_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t max;        //usec
+    uint64_t sum;
+} profile_busy_t;
+
+typedef struct {
+    uint8_t  cycle;
+    uint8_t  busyWaits;
+    uint8_t  displaySkipped;
+    uint32_t phase[PROFILE_PHASES];  //usec
+} profile_record_t;
+
+//histogram scale per cycle type: first bucket starts at base msec
+//and every bucket is width msec wide. The last bucket takes the rest
+static const uint16_t histBase[PROFILE_CYCLES]  = { 100, 150, 3000, 3000 };
+static const uint16_t histWidth[PROFILE_CYCLES] = {  10,  10,  250,  500 };
+
+static const char *phaseNames[PROFILE_PHASES] = {
+    "boot", "app", "nvs", "charger", "sync", "eink_start", "eink_init",
+    "eink_draw", "eink_spi", "eink_busy", "rotate", "sleep", "light_sleep"
+};
+
+static const char *cycleNames[PROFILE_CYCLES] = {
+    "partial", "full", "rotate", "sync"
+};
+
+static const char *busyNames[PROFILE_BUSY_KINDS] = {
+    "reset", "soft_reset", "power_on", "lut", "ram", "update"
+};
+
+RTC_DATA_ATTR static profile_stats_t  profile_stats[PROFILE_CYCLES];
+RTC_DATA_ATTR static profile_record_t profile_recent[PROFILE_RECENT];
+RTC_DATA_ATTR static profile_busy_t   profile_busy_stats[PROFILE_BUSY_KINDS];
+RTC_DATA_ATTR static uint32_t profile_waveforms[WAVEFORM_KINDS];
+RTC_DATA_ATTR static int8_t   profile_temperature = WAVEFORM_TEMP_UNKNOWN;
+RTC_DATA_ATTR static uint8_t  profile_recent_next = 0;
+RTC_DATA_ATTR static int64_t  profile_sleep_at = 0;  //RTC time entering deep sleep
+RTC_DATA_ATTR static uint64_t profile_sleep_for = 0;
+
+static profile_record_t current;
+static int     currentPhase = PROFILE_BOOT;
+static int64_t phaseStart = 0;
+
+static int64_t profile_rtc_us(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec*1000000LL+tv.tv_usec;
+}
+
+//start profiling this wake. Invoke first thing in app_main
+void profile_start(void) {
+    memset(&current, 0, sizeof(current));
+    phaseStart = esp_timer_get_time();
+    int64_t boot = phaseStart;
+    if(esp_reset_reason()==ESP_RST_DEEPSLEEP && profile_sleep_for>0) {
+        //the RTC keeps running in deep sleep. So the time between
+        //the planned wake up and now is the time it took to boot
+        int64_t wake = profile_sleep_at+(int64_t)profile_sleep_for;
+        int64_t t = profile_rtc_us()-wake;
+        if(t>0 && t<10000000) boot = t;
+    }
+    current.phase[PROFILE_BOOT] = (uint32_t)boot;
+    currentPhase = PROFILE_APP;
+}
+
+//switch to a new phase. Returns the phase that was active
+//so the caller can switch back to it when done.
+int profile_phase(int phase) {
+    int64_t now = esp_timer_get_time();
+    int prev = currentPhase;
+    current.phase[prev] += (uint32_t)(now-phaseStart);
+    if(phase==PROFILE_EINK_BUSY) current.busyWaits++;
+    phaseStart = now;
+    currentPhase = phase;
+    return prev;
+}
+
+//display already showed the right screen so it was not updated
+void profile_display_skipped(void) {
+    current.displaySkipped = 1;
+}
+
+//the display was busy for us usec. busy tells with what
+void profile_busy(int busy, uint32_t us) {
+    profile_busy_t *b = &profile_busy_stats[busy];
+    b->count++;
+    b->sum += us;
+    if(us>b->max) b->max = us;
+}
+
+//the display was updated with waveform at temperature degrees C
+void profile_waveform(int waveform, int temperature) {
+    if(waveform<0 || waveform>=WAVEFORM_KINDS) return;
+    profile_waveforms[waveform]++;
+    profile_temperature = (int8_t)temperature;
+}
+
+//wake is done. Fold the phase times into the statistics.
+//Invoke right before esp_deep_sleep.
+void profile_sleep(int cycle, uint64_t sleep_us) {
+    profile_phase(PROFILE_SLEEP);
+    current.cycle = (uint8_t)cycle;
+    uint32_t total = 0;
+    for(int i=0; i<PROFILE_PHASES; i++) total += current.phase[i];
+
+    profile_stats_t *s = &profile_stats[cycle];
+    for(int i=0; i<=PROFILE_PHASES; i++) {
+        uint32_t t = (i<PROFILE_PHASES)?current.phase[i]:total;
+        if(s->count==0 || t<s->min[i]) s->min[i] = t;
+        if(t>s->max[i]) s->max[i] = t;
+        s->sum[i] += t;
+    }
+    int b = ((int)(total/1000)-histBase[cycle])/histWidth[cycle];
+    if(b<0) b = 0;
+    if(b>=PROFILE_HIST) b = PROFILE_HIST-1;
+    if(s->hist[b]<UINT16_MAX) s->hist[b]++;
+    s->count++;
+    s->displaySkipped += current.displaySkipped;
+
+    profile_recent[profile_recent_next] = current;
+    profile_recent_next = (profile_recent_next+1)%PROFILE_RECENT;
+
+    profile_sleep_at = profile_rtc_us();
+    profile_sleep_for = sleep_us;
+}
+
+//write the statistics as json object into buf
+//returns the number of characters written
+int profile_json(char *buf, int len) {
+    int n = 0;
+#define OUT(...) do { if(n<len) n += snprintf(buf+n, len-n, __VA_ARGS__); } while(0)
+    OUT("{\"phases\":[");
+    for(int i=0; i<PROFILE_PHASES; i++) OUT("%s\"%s\"", i?",":"", phaseNames[i]);
+    OUT("],\"cycles\":{");
+    for(int c=0; c<PROFILE_CYCLES; c++) {
+        profile_stats_t *s = &profile_stats[c];
+        OUT("%s\"%s\":{\"count\":%u,\"skipped\":%u", c?",":"", cycleNames[c],
+            s->count, s->displaySkipped);
+        //min, mean and max in usec, total first then the phases
+        OUT(",\"total\":[%u,%u,%u]", s->min[PROFILE_PHASES],
+            s->count?(uint32_t)(s->sum[PROFILE_PHASES]/s->count):0, s->max[PROFILE_PHASES]);
+        OUT(",\"phases\":[");
+        for(int i=0; i<PROFILE_PHASES; i++) {
+            OUT("%s[%u,%u,%u]", i?",":"", s->min[i],
+                s->count?(uint32_t)(s->sum[i]/s->count):0, s->max[i]);
+        }
+        OUT("],\"hist\":{\"base\":%u,\"width\":%u,\"counts\":[", histBase[c], histWidth[c]);
+        for(int i=0; i<PROFILE_HIST; i++) OUT("%s%u", i?",":"", s->hist[i]);
+        OUT("]}}");
+    }
+    //busy time per command in usec: count, mean and max
+    OUT("},\"busy\":{");
+    for(int i=0; i<PROFILE_BUSY_KINDS; i++) {
+        profile_busy_t *b = &profile_busy_stats[i];
+        OUT("%s\"%s\":[%u,%u,%u]", i?",":"", busyNames[i], b->count,
+            b->count?(uint32_t)(b->sum/b->count):0, b->max);
+    }
+    //updates per waveform and the last temperature of the display
+    OUT("},\"waveforms\":{");
+    for(int i=0; i<WAVEFORM_KINDS; i++) {
+        OUT("%s\"%s\":%u", i?",":"", waveforms[i].name, profile_waveforms[i]);
+    }
+    OUT("},\"temperature\":%d", profile_temperature);
+    OUT(",\"recent\":[");
+    //oldest first
+    int first = 1;
+    for(int r=0; r<PROFILE_RECENT; r++) {
+        profile_record_t *rec = &profile_recent[(profile_recent_next+r)%PROFILE_RECENT];
+        if(rec->phase[PROFILE_BOOT]==0) continue; //never filled
+        OUT("%s{\"cycle\":\"%s\",\"busy_waits\":%u,\"skipped\":%u,\"phases\":[", first?"":",",
+            cycleNames[rec->cycle], rec->busyWaits, rec->displaySkipped);
+        for(int i=0; i<PROFILE_PHASES; i++) OUT("%s%u", i?",":"", rec->phase[i]);
+        OUT("]}");
+        first = 0;
+    }
+    OUT("]}");
+#undef OUT
+    return (n<len)?n:len-1;
+}
@@ -0,0 +1,47 @@
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#include <stdint.h>
+
+//phases of a wake cycle. The time of a wake is split over the phases
+//so the phase times add up to the total active time
+#define PROFILE_BOOT        0   //ROM, bootloader and startup till app_main
+#define PROFILE_APP         1   //app_main itself
+#define PROFILE_NVS         2   //nvs_flash_init
+#define PROFILE_CHARGER     3   //reading the charger module
+#define PROFILE_SYNC        4   //wifi and SNTP
+#define PROFILE_EINK_START  5   //eink io setup and hardware reset
+#define PROFILE_EINK_INIT   6   //eink initialization and LUT
+#define PROFILE_EINK_DRAW   7   //rendering the frame and updating the display
+#define PROFILE_EINK_SPI    8   //SPI transfers to the display
+#define PROFILE_EINK_BUSY   9   //waiting for the busy line of the display
+#define PROFILE_ROTATE     10   //waiting for the rings to rotate
+#define PROFILE_SLEEP      11   //preparing deep sleep
+#define PROFILE_LIGHT_SLEEP 12  //cpu in light sleep waiting for the display
+#define PROFILE_PHASES     13
+
+//cycle types
+#define PROFILE_CYCLE_PARTIAL 0
+#define PROFILE_CYCLE_FULL    1
+#define PROFILE_CYCLE_ROTATE  2
+#define PROFILE_CYCLE_SYNC    3
+#define PROFILE_CYCLES        4
+
+//what the display was busy with while waiting for its busy line
+#define PROFILE_BUSY_RESET    0   //hardware reset
+#define PROFILE_BUSY_SWRESET  1   //soft reset (0x12)
+#define PROFILE_BUSY_POWERON  2   //clock, temperature and LUT from OTP (0x22 0xB1)
+#define PROFILE_BUSY_LUT      3   //loading a LUT (0x32)
+#define PROFILE_BUSY_RAM      4   //setting the ram window
+#define PROFILE_BUSY_UPDATE   5   //display update (0x20)
+#define PROFILE_BUSY_KINDS    6
+
+void profile_start(void);
+int  profile_phase(int phase);
+void profile_display_skipped(void);
+void profile_busy(int busy, uint32_t us);
+void profile_waveform(int waveform, int temperature);
+void profile_sleep(int cycle, uint64_t sleep_us);
+int  profile_json(char *buf, int len);
+
+#endif
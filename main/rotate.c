@@ -12,11 +12,16 @@
  *
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/event_groups.h"
 #include "esp_system.h"
 #include "driver/gpio.h"
 #include "tmc2209.h"
+#include "rotate_code.h"
 
 RTC_DATA_ATTR static int8_t current_hour = 0;
 
@@ -41,57 +46,16 @@ static int get_hours_ring_sensors(void) {
     return sensors;
 }
 
-//mapping two subsequent position of the hours ring
-//to the actual hour on the ring
-//when rotating counter clockwise
-//0 means invalid
-static int8_t sensorsMappingCC[] = {
-//   0   1   2   3   4   5   6   7   new/cur
-     0,  0,  0,  0,  0,  0,  0,  0,     //0
-     0,  0,  0,  0,  0,  0,  0,  6,     //1
-     0,  1,  0,  0, 10,  0,  0,  0,     //2
-     0,  0,  0,  0,  0,  0,  0,  4,     //3
-     0,  0,  0,  0,  0,  3,  0,  0,     //4
-     0,  0,  8,  0,  0,  0,  0, 12,     //5
-     0,  0,  0,  0,  0,  7,  0,  0,     //6
-     0,  0,  5, 11,  0,  0,  2,  9      //7
-};
-
+//sensorsMappingCC, sensorsMappingCW and expectMap are generated from
+//the magnet layout in rotate_code.txt, see tools/rotate_code_gen.py
 
-//mapping two subsequent position of the hours ring
-//to the actual hour on the ring
-//when rotating clockwise
-//0 means invalid
-static int8_t sensorsMappingCW[] = {
-//   0   1   2   3   4   5   6   7   new/cur
-     0,  0,  0,  0,  0,  0,  0,  0,     //0
-     0,  0,  8,  0,  0,  0,  0,  0,     //1
-     0,  0,  0,  0,  0,  3,  0, 12,     //2
-     0,  0,  0,  0,  0,  0,  0,  6,     //3
-     0,  0,  5,  0,  0,  0,  0,  0,     //4
-     0,  0,  0,  0, 10,  0,  2,  0,     //5
-     0,  0,  0,  0,  0,  0,  0,  9,     //6
-     0,  1,  0, 11,  0,  7,  0,  4      //7
-};
-
-//mapping hour to sensor value
-//list extends to 19 to make allow determining the sensor value
-//for the next and the previous position on the ring
-//i.e. +5 and -5 = (-5+12=+7) hours
-//position 0 is not used. max index=12-5+12=19
-static uint8_t expectMap[] = {
-//0   1   2   3   4   5   6   7   8   9  10  11  12  13  14  15  16  17  18  19
-  0,  1,  6,  5,  7,  2,  7,  5,  2,  7,  4,  3,  7,  1,  6,  5,  7,  2,  7,  5
-};
-
-volatile static int hours_ring_prev=0;
-volatile static int hours_ring_current=0;
-volatile static int hours_ring_current_threshold=0;
-volatile static int hours_ring_expect=0;
-volatile static int hours_ring_direction=0;
-volatile static int hours_ring_hour=0;
-volatile static int hours_ring_zero_threshold=0;
-volatile static int hours_ring_velocity=0;
+static int hours_ring_prev=0;
+static int hours_ring_current=0;
+static int hours_ring_expect=0;
+static int hours_ring_direction=0;
+static int hours_ring_hour=0;
+static int hours_ring_velocity=0;
+static int hours_ring_measuring=0; //travel started at the previous position
 
 //at full speed the hours ring moves about 1cm in 80msec
 //full speed has a velocity of 0x18000
@@ -103,134 +67,338 @@ volatile static int hours_ring_velocity=0;
 //Using a little lower value to compensate for overshoot
 #define HOURS_RING_CURRENT_THRESHOLD 0x270000
 
-static void read_sensors_timer(void* arg)
-{
-    //this method is only invoked when hour ring is moving
-    //get sensors for hours ring
-    int sensors = get_hours_ring_sensors();
-    if(sensors==0) {
-        //none of the sensors is currently active
-        hours_ring_current_threshold=0;
-        hours_ring_zero_threshold+=hours_ring_velocity;
-        if(hours_ring_current!=0) {
-            //still debouncing zero sensor state
-            hours_ring_zero_threshold+=hours_ring_velocity;
-            if(hours_ring_zero_threshold>HOURS_RING_ZERO_THRESHOLD) {
-                //just debounce zero sensors state
-                //deterine current position of hours ring
-                int h=0;
-                if(hours_ring_direction) {
-                    h=sensorsMappingCW[hours_ring_prev+hours_ring_current];
-                    hours_ring_expect=expectMap[h+7];
-                } else {
-                    h=sensorsMappingCC[hours_ring_prev+hours_ring_current];
-                    hours_ring_expect=expectMap[h+5];
-                }
-                if(h==0) {
-                     //don't know where we are
-                     hours_ring_expect=0;
-                     hours_ring_hour=0;
-                }
-                hours_ring_prev=hours_ring_current*8;
-                hours_ring_current=0;
-            }
+//motion of the hours ring. The velocity goes up and down by
+//HOURS_RING_ACCEL every 10 msec so the ring starts at and slows down
+//to HOURS_RING_START. Distances are velocity times msec, see
+//hours_ring_odometer. 0xC0000 is about 1 mm
+#define HOURS_RING_START   0x5000
+#define HOURS_RING_SEARCH  0x18000   //max velocity while the position is unknown
+#define HOURS_RING_CRUISE  0x24000   //max velocity on the way to a known target
+#define HOURS_RING_ACCEL   0x400
+#define HOURS_RING_SLOT    0x4380000 //9 cm between two positions
+//a position is detected about 2 mm before the center of its magnets
+#define HOURS_RING_LANDING 0x180000
+
+//sensor edges as seen by the interrupt handler. Every ring has a
+//queue of its own. The handler is the only one writing head and the
+//task of the ring the only one writing tail, so they don't need a lock
+typedef struct {
+    int64_t time;     //esp_timer_get_time() of the edge
+    uint8_t pin;
+    uint8_t level;
+} sensor_event_t;
+
+#define SENSOR_EVENTS 64  //power of 2
+typedef struct {
+    sensor_event_t events[SENSOR_EVENTS];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile int overflow;
+} sensor_queue_t;
+
+typedef struct {
+    gpio_num_t pin;
+    sensor_queue_t *queue;
+} sensor_pin_t;
+
+static void IRAM_ATTR sensor_isr(void *arg) {
+    const sensor_pin_t *sensor=(const sensor_pin_t *)arg;
+    sensor_queue_t *q=sensor->queue;
+    uint32_t head=q->head;
+    if(head-q->tail>=SENSOR_EVENTS) {
+        q->overflow=1;
+        return;
+    }
+    sensor_event_t *e=&q->events[head&(SENSOR_EVENTS-1)];
+    e->time=esp_timer_get_time();
+    e->pin=(uint8_t)sensor->pin;
+    e->level=(uint8_t)gpio_get_level(sensor->pin);
+    //the event must be complete before the task can see it
+    __sync_synchronize();
+    q->head=head+1;
+}
+
+//The velocity only changes when the task sets it, so the travel of
+//the hours ring at any time follows from the last velocity change
+static int64_t odometerTime=0;  //esp_timer_get_time() of the last change
+static int64_t odometerBase=0;  //travel at odometerTime
+static int odometerVelocity=0;  //velocity sent to the motor driver
+
+static int64_t hours_ring_odometer(int64_t time) {
+    return odometerBase+(int64_t)odometerVelocity*(time-odometerTime)/1000;
+}
+
+static void hours_ring_odometer_velocity(int velocity) {
+    int64_t now=esp_timer_get_time();
+    odometerBase=hours_ring_odometer(now);
+    odometerTime=now;
+    odometerVelocity=velocity;
+}
+
+//debouncing of the hours ring sensors on the travel of the ring.
+//hours_ring_since is where the sensors last went from all off to
+//some on or back. hours_ring_settled is 1 once the state has lasted
+//its threshold and -1 while the state is to be ignored
+static int hours_ring_sensors=0;
+static int64_t hours_ring_since=0;
+static int hours_ring_settled=0;
+static int64_t hours_ring_detected_at=0;  //travel when hours_ring_hour was detected
+
+//travel between two positions as measured, per segment of the ring.
+//The tyre of the motor slips a little on the wood and more where the
+//ring is out of round, so it takes more than HOURS_RING_SLOT to get
+//from one position to the next. Segment n runs from hour n to hour
+//n+5 (counter clockwise), index 0 is hour 12. 0 if not measured yet
+RTC_DATA_ATTR static uint32_t segmentTravel[12];
+
+//segment the ring passes when leaving hour in direction
+static int hours_ring_segment(int hour, int direction) {
+    return direction?(hour+7)%12:hour%12;
+}
+
+//hour of the next position in direction
+static int hours_ring_next(int hour, int direction) {
+    return direction?(hour+6)%12+1:(hour+4)%12+1;
+}
+
+static int hours_ring_slot(int segment) {
+    return segmentTravel[segment]?segmentTravel[segment]:HOURS_RING_SLOT;
+}
+
+static void hours_ring_detected(int h, int64_t at) {
+    if(h==hours_ring_hour) return;
+    if(h!=0 && hours_ring_measuring &&
+       h==hours_ring_next(hours_ring_hour, hours_ring_direction)) {
+        //went from one position to the next so the travel is a
+        //whole segment. Anything far off nominal is a misdetection
+        int64_t travel=at-hours_ring_detected_at;
+        if(travel>HOURS_RING_SLOT*3/4 && travel<HOURS_RING_SLOT*5/4) {
+            int segment=hours_ring_segment(hours_ring_hour, hours_ring_direction);
+            uint32_t learned=segmentTravel[segment];
+            segmentTravel[segment]=learned?learned+((int)(travel-learned))/4:(uint32_t)travel;
         }
-    } else {
-        //sensors are not 0 so try to get the correct sensor value
-        //unfortunately not all sensors trigger at the same time
-        //so debounce and try to find the center position of the sensors
-        hours_ring_zero_threshold=0;
-        hours_ring_current_threshold+=hours_ring_velocity;
-        if(hours_ring_current_threshold>HOURS_RING_CURRENT_THRESHOLD) {
-            //detected a non zero value long enough
-            if(hours_ring_current<sensors) hours_ring_current = sensors;
-            if(hours_ring_current==hours_ring_expect) {
-                //detected the expected value. Assume this is the
-                //correct value for the current position
-                //So update current hour
-                //We're not expecting a new sensor value yet
-                //so leave that as is
-                if(hours_ring_direction) {
-                    hours_ring_hour=sensorsMappingCW[hours_ring_prev+hours_ring_current];
-                } else {
-                    hours_ring_hour=sensorsMappingCC[hours_ring_prev+hours_ring_current];
-                }
-            }
+    }
+    hours_ring_measuring=(h!=0);
+    hours_ring_detected_at=at;
+    hours_ring_hour=h;
+}
+
+//average slip of the hours motor in 0.1% over the measured segments
+static int hours_ring_slip(void) {
+    int64_t sum=0;
+    int n=0;
+    for(int i=0; i<12; i++) {
+        if(segmentTravel[i]==0) continue;
+        sum+=segmentTravel[i];
+        n++;
+    }
+    if(n==0) return 0;
+    return (int)(1000-(int64_t)HOURS_RING_SLOT*n*1000/sum);
+}
+
+//some sensors are active long enough at travel 'at'
+//unfortunately not all sensors trigger at the same time
+//so try to find the center position of the sensors
+static void hours_ring_take(int64_t at) {
+    if(hours_ring_current<hours_ring_sensors) hours_ring_current=hours_ring_sensors;
+    if(hours_ring_current==hours_ring_expect) {
+        //detected the expected value. Assume this is the
+        //correct value for the current position
+        //So update current hour
+        //We're not expecting a new sensor value yet
+        //so leave that as is
+        if(hours_ring_direction) {
+            hours_ring_detected(sensorsMappingCW[hours_ring_prev+hours_ring_current], at);
+        } else {
+            hours_ring_detected(sensorsMappingCC[hours_ring_prev+hours_ring_current], at);
         }
     }
 }
 
+//the sensors did not change up to travel 'at'. Check whether the
+//current state has lasted long enough
+static void hours_ring_debounce(int64_t at) {
+    if(hours_ring_settled) return;
+    if(hours_ring_sensors==0) {
+        //the zero state was debounced on double the travel
+        //when the 1 msec poll did this, keep it that way
+        if(hours_ring_current==0 ||
+           at-hours_ring_since<=HOURS_RING_ZERO_THRESHOLD/2) return;
+        //just debounce zero sensors state
+        //deterine current position of hours ring
+        int h=0;
+        if(hours_ring_direction) {
+            h=sensorsMappingCW[hours_ring_prev+hours_ring_current];
+            hours_ring_expect=expectMap[h+7];
+        } else {
+            h=sensorsMappingCC[hours_ring_prev+hours_ring_current];
+            hours_ring_expect=expectMap[h+5];
+        }
+        if(h==0) {
+             //don't know where we are
+             hours_ring_expect=0;
+             hours_ring_detected(0, at);
+        }
+        hours_ring_prev=hours_ring_current*8;
+        hours_ring_current=0;
+        hours_ring_settled=1;
+    } else if(at-hours_ring_since>HOURS_RING_CURRENT_THRESHOLD) {
+        //detected a non zero value long enough
+        hours_ring_settled=1;
+        hours_ring_take(hours_ring_since+HOURS_RING_CURRENT_THRESHOLD);
+    }
+}
+
+//sensor 'bit' of the hours ring changed to 'level' at travel 'at'
+static void hours_ring_edge(int bit, int level, int64_t at) {
+    hours_ring_debounce(at);
+    int sensors=hours_ring_sensors;
+    //note that sensors are low active
+    if(level) sensors&=~bit;
+    else sensors|=bit;
+    if(sensors==hours_ring_sensors) return;
+    if((sensors==0)!=(hours_ring_sensors==0)) {
+        hours_ring_sensors=sensors;
+        hours_ring_since=at;
+        hours_ring_settled=0;
+    } else {
+        hours_ring_sensors=sensors;
+        if(sensors && hours_ring_settled>0) hours_ring_take(at);
+    }
+}
+
 //threshold value to detect sensor active for hourglass ring
 #define HOURGLASS_SENSOR_THRESHOLD   0x48000
+#define HOURGLASS_VELOCITY           0x10000
 
-static int hourglass_sensor_threshold=0;
+static int64_t hourglass_sensor_since=0;  //time of the last edge
+static int hourglass_sensor_level=1;      //level after it. Sensor is low active
+static int hourglass_left=0;              //ring left the magnet it started on
 
-//read sensor of the hourglass ring and debounce
-//take rotation speed into account
-//when velocity is 0 return actual sensor value as the rings are not turning
-//the trheshold will never be reached and the value will not change
-static int get_hourglass_ring_sensor(int velocity) {
-    if(gpio_get_level(ROTATE_SENSOR4)) {
-        //sensor not active. Clear threshold
-        hourglass_sensor_threshold = 0;
-    } else {
-        if(velocity==0) return 1;
-        hourglass_sensor_threshold+=velocity;
-        if(hourglass_sensor_threshold>=HOURGLASS_SENSOR_THRESHOLD) {
-            hourglass_sensor_threshold=HOURGLASS_SENSOR_THRESHOLD;
-            return 1; //sensor is active
-        }
+//the sensor of the hourglass ring kept its level long enough
+//take rotation speed into account: HOURGLASS_SENSOR_THRESHOLD is
+//velocity times 10 msec
+static int hourglass_sensor_settled(void) {
+    int64_t held=esp_timer_get_time()-hourglass_sensor_since;
+    return held*HOURGLASS_VELOCITY/10000>=HOURGLASS_SENSOR_THRESHOLD;
+}
+
+static int hourglass_start(void) {
+    hourglass_sensor_level=gpio_get_level(ROTATE_SENSOR4);
+    hourglass_sensor_since=esp_timer_get_time();
+    hourglass_left=0;
+    //just start motor. no ramp up necessary
+    tmc2209_rotate_cw(2, HOURGLASS_VELOCITY);
+    return 1;
+}
+
+static void hourglass_edge(int pin, int level, int64_t time) {
+    if(level==hourglass_sensor_level) return;
+    hourglass_sensor_level=level;
+    hourglass_sensor_since=time;
+}
+
+static void hourglass_lost(void) {
+    hourglass_edge(ROTATE_SENSOR4, gpio_get_level(ROTATE_SENSOR4), esp_timer_get_time());
+}
+
+//turn till the sensor finds the next magnet after the one the ring
+//started on
+static int hourglass_step(void) {
+    if(!hourglass_sensor_settled()) return 1;
+    if(hourglass_sensor_level) {
+        hourglass_left=1;
+        return 1;
     }
-    return 0; //sensor is inactive
+    //found stop position so we're done
+    return !hourglass_left;
 }
 
+static void hours_ring_event(int pin, int level, int64_t time) {
+    int bit=(pin==ROTATE_SENSOR1)?0x01:(pin==ROTATE_SENSOR2)?0x02:0x04;
+    hours_ring_edge(bit, level, hours_ring_odometer(time));
+}
 
-static int8_t rotate_task_target=1;
+//edges got lost. Start over from the current levels
+//without knowing where the hours ring is
+static void hours_ring_lost(void) {
+    hours_ring_sensors=get_hours_ring_sensors();
+    hours_ring_since=hours_ring_odometer(esp_timer_get_time());
+    hours_ring_settled=hours_ring_sensors?-1:0;
+    hours_ring_prev=0;
+    hours_ring_current=0;
+    hours_ring_expect=0;
+    hours_ring_detected(0, hours_ring_since);
+}
 
-void rotate_rings_task(void *params) {
-    //Note: charging should be disabled already
-    //Power up motor driver
-    gpio_set_direction((gpio_num_t)VCC2_ENABLE, GPIO_MODE_OUTPUT);
-    gpio_set_level((gpio_num_t)VCC2_ENABLE, 1);
-    //wait a little bit to let vcc2 staiblize
-    vTaskDelay(50 / portTICK_RATE_MS);
+static int8_t rotate_task_target=1;
 
-    //configure position sensors as input
-    gpio_set_direction((gpio_num_t)ROTATE_SENSOR1, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR1, GPIO_PULLUP_ONLY);
-    gpio_set_direction((gpio_num_t)ROTATE_SENSOR2, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR2, GPIO_PULLUP_ONLY);
-    gpio_set_direction((gpio_num_t)ROTATE_SENSOR3, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR3, GPIO_PULLUP_ONLY);
-    gpio_set_direction((gpio_num_t)ROTATE_SENSOR4, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR4, GPIO_PULLUP_ONLY);
+//travel of the hours ring since the current position was detected
+static int64_t hours_ring_travel(void) {
+    return hours_ring_odometer(esp_timer_get_time())-hours_ring_detected_at;
+}
 
-    tmc2209_init();
+//number of positions the hours ring still has to pass in its current
+//direction. Rotating counter clockwise adds 5 to the hour
+static int hours_ring_positions_left(void) {
+    int left=((rotate_task_target-hours_ring_hour)*5)%12;
+    if(left<0) left+=12;
+    if(hours_ring_direction) left=(12-left)%12;
+    return left;
+}
 
-    //create timer to determine position of hours ring
-    const esp_timer_create_args_t sensors_timer_args = {
-        .callback = &read_sensors_timer,
-        /* name is optional, but may help identify the timer when debugging */
-        .name = "sensors"
-    };
-    esp_timer_handle_t sensors_timer;
-    ESP_ERROR_CHECK(esp_timer_create(&sensors_timer_args, &sensors_timer));
-    /* The timer has been created but is not running yet */
+//velocity of the hours ring for the next 10 msec. Accelerates to the
+//cruise velocity and decelerates in time to arrive at the center of
+//the target magnets at HOURS_RING_START. The distance left is looked
+//at one tick ahead as that's when the next velocity can be set
+static int hours_ring_plan(void) {
+    int velocity=hours_ring_velocity;
+    int max=HOURS_RING_SEARCH;
+    if(hours_ring_hour!=0) {
+        int64_t left=HOURS_RING_LANDING-hours_ring_travel()-velocity*10;
+        int hour=hours_ring_hour;
+        for(int i=hours_ring_positions_left(); i>0; i--) {
+            left+=hours_ring_slot(hours_ring_segment(hour, hours_ring_direction));
+            hour=hours_ring_next(hour, hours_ring_direction);
+        }
+        if(left<0) left=0;
+        //v^2 = start^2 + 2*a*d with a = HOURS_RING_ACCEL/10 per msec
+        float brake=sqrtf((float)HOURS_RING_START*HOURS_RING_START
+                          +(float)HOURS_RING_ACCEL*(float)left/5.0f);
+        max=HOURS_RING_CRUISE;
+        if(brake<max) max=(int)brake;
+    }
+    if(velocity<max) {
+        velocity+=HOURS_RING_ACCEL;
+        if(velocity>max) velocity=max;
+    } else if(velocity>max) {
+        velocity-=HOURS_RING_ACCEL;
+        if(velocity<max) velocity=max;
+    }
+    if(velocity<HOURS_RING_START) velocity=HOURS_RING_START;
+    return velocity;
+}
 
+static int hours_ring_written=0; //velocity last sent to the motor driver
 
-    //Handle rotating the rings.
-    //Check position sensors every 10 msec to see if the target is reached
-    int cnt=0;
+static int hours_ring_start(void) {
     //determine sensor actual sensors value
     int sensors = get_hours_ring_sensors();
     hours_ring_expect = 0;
     hours_ring_current=0;
     hours_ring_prev = 0;
     hours_ring_direction = 0; //default rotate counter clockwise 
-    hours_ring_velocity=0x5000;
+    hours_ring_velocity=HOURS_RING_START;
+    hours_ring_written=0;
+    odometerTime=esp_timer_get_time();
+    odometerBase=0;
+    odometerVelocity=0;
+    hours_ring_detected_at=0;
+    hours_ring_measuring=0;
+    hours_ring_sensors=sensors;
+    hours_ring_since=0;
     //make sure we detect zero state first
-    hours_ring_current_threshold=INT_MIN;
-    hours_ring_zero_threshold=0;
+    hours_ring_settled=sensors?-1:0;
     if(!(current_hour>0 && current_hour<=12 && expectMap[current_hour]==sensors)) {
         //sensor position is not what we expect
         //or we don't know what to expect
@@ -238,6 +406,8 @@ void rotate_rings_task(void *params) {
     } else {
         //sensor value is what we expect
         hours_ring_hour=current_hour;
+        //the ring stopped at the center of the magnets
+        hours_ring_detected_at=-HOURS_RING_LANDING;
         //set expect to the next hour
         if(current_hour==1 && rotate_task_target==3) {
             //Handle DST change winter to summer time
@@ -251,117 +421,208 @@ void rotate_rings_task(void *params) {
         } else if(current_hour==2 && rotate_task_target==2) {
             //Handle DST change summer to winter time
             //the hours ring does not need to turn at all.
-            hours_ring_velocity=0;
-            rotate_task_state&=~0x01;
+            return 0;
         } else {
             //We're probably at the expected location
             //In that case we need to rotate 5 positions
-            //We need 2 positions to determine the correct location
-            //so don't preload. We'll detect the correct position
-            //in time without issues
+            //Preload the previous position so the position stays
+            //known when leaving this one and the motion can be
+            //planned all the way. When we're not where we think we
+            //are, the next position won't be the expected one
+            hours_ring_prev=expectMap[current_hour+7]*8;
+            hours_ring_current=sensors;
         }
     }
-    //start 1msec periodic timer when required
-    if(rotate_task_state&0x01) {
-        ESP_ERROR_CHECK(esp_timer_start_periodic(sensors_timer, 1000));
-printf("started timer");
-    }
 printf("sensors: %d, %d, %d, %d\n", hours_ring_prev, hours_ring_current,
              hours_ring_expect, hours_ring_hour);
-    while(rotate_task_state&0x03 && cnt<1500) //rotate max 15 seconds
-    {
-        if(rotate_task_state&0x01) {
-            //handle hours ring iteration
-            //get sensors using old velocity value
-            //afterall, that was used the last tick anyway
-            if((hours_ring_velocity<0x18000) && ((cnt&0x03)==0)) {
-                //ramp up every 40msec till max speed
-                hours_ring_velocity+=0x1000;
-                if(hours_ring_direction) tmc2209_rotate_cw(1, hours_ring_velocity);
-                else tmc2209_rotate_cc(1, hours_ring_velocity);
-            }
-            //stored position is invalid. Clear it
-            current_hour=0;
-            if(hours_ring_hour==rotate_task_target) {
-                //at target position. Stop turning
-                current_hour=hours_ring_hour; //Position is valid
-                tmc2209_stop(1);
-                //clear motor1 task state bit
-                rotate_task_state&=~0x01;
-                //stop periodic timer
-                esp_timer_stop(sensors_timer);
-            } else {
-                if(hours_ring_hour!=0 && hours_ring_direction==0) {
-                    //we know where we are and where we are going
-                    //determine rotation direction to get there
-                    //the fastest but only change direction when
-                    //rotating counter clockwise (i.e. direction==0)
-                    //just to make sure we change direction only once
-                    int tmp=((rotate_task_target-hours_ring_hour)*5)%12;
-                    if(tmp<0) tmp+=12;
-                    if(tmp>6) {
-                        //changing direction.
-                        //stop timer
-                        esp_timer_stop(sensors_timer);
-                        hours_ring_direction=1;
-                        tmc2209_stop(1); //stop rotating
-                        hours_ring_velocity=0x5000; //start rampup again
-                        //make sure the current position is known
-                        //for reversing direction
-                        hours_ring_prev=expectMap[hours_ring_hour+5]*8;
-                        hours_ring_current=expectMap[hours_ring_hour];
-                        hours_ring_expect=hours_ring_current;
-                        //ignore current position till sensors go
-                        //from non zero back to zero again
-                        hours_ring_zero_threshold=INT_MIN;
-                        //restart timer
-                        ESP_ERROR_CHECK(esp_timer_start_periodic(sensors_timer, 1000));
-                    }
-                } 
-            }
+    return 1;
+}
+
+//check the position of the hours ring every 10 msec to see if the
+//target is reached and plan the velocity for the next 10 msec
+static int hours_ring_step(void) {
+    hours_ring_debounce(hours_ring_odometer(esp_timer_get_time()));
+    //stored position is invalid. Clear it
+    current_hour=0;
+    if(hours_ring_hour==rotate_task_target &&
+       hours_ring_travel()>=HOURS_RING_LANDING) {
+        //at the center of the target position. Stop turning
+        current_hour=hours_ring_hour; //Position is valid
+        return 0;
+    }
+    if(hours_ring_hour!=0 && hours_ring_direction==0) {
+        //we know where we are and where we are going
+        //determine rotation direction to get there
+        //the fastest but only change direction when
+        //rotating counter clockwise (i.e. direction==0)
+        //just to make sure we change direction only once
+        if(hours_ring_positions_left()>6) {
+            //changing direction.
+            hours_ring_direction=1;
+            tmc2209_stop(1); //stop rotating
+            hours_ring_odometer_velocity(0);
+            hours_ring_written=0;
+            hours_ring_velocity=HOURS_RING_START; //start rampup again
+            //the ring is just past the position it found.
+            //Good enough to plan the way back
+            hours_ring_detected_at=hours_ring_odometer(esp_timer_get_time());
+            hours_ring_measuring=0;
+            //make sure the current position is known
+            //for reversing direction
+            hours_ring_prev=expectMap[hours_ring_hour+5]*8;
+            hours_ring_current=expectMap[hours_ring_hour];
+            hours_ring_expect=hours_ring_current;
+            //ignore current position till sensors go
+            //from non zero back to zero again
+            if(hours_ring_sensors==0) hours_ring_settled=-1;
         }
+    }
+    hours_ring_velocity=hours_ring_plan();
+    if(hours_ring_velocity!=hours_ring_written) {
+        hours_ring_written=hours_ring_velocity;
+        if(hours_ring_direction) tmc2209_rotate_cw(1, hours_ring_velocity);
+        else tmc2209_rotate_cc(1, hours_ring_velocity);
+        hours_ring_odometer_velocity(hours_ring_velocity);
+    }
+    return 1;
+}
 
-        if(rotate_task_state&0x02) {
-            //handle hoursglass iteration
-            if(cnt==0) {
-                //just start motor. no ramp up necessary
-                tmc2209_rotate_cw(2, 0x10000);
-            }
-            int sensors=get_hourglass_ring_sensor(0x10000);
-            if(cnt>100 && sensors==1) {
-                //found stop position so we're done
-                tmc2209_stop(2);
-                rotate_task_state&=~0x02; //clear motor2 task state bit
+//bits in rotateEvents. The bits of the rings are the same as those
+//in rotate_task_state, which only the RotateRings task changes
+#define ROTATE_HOURS_DONE      BIT0
+#define ROTATE_HOURGLASS_DONE  BIT1
+#define ROTATE_DONE            BIT2   //motors are off and powered down
+
+static EventGroupHandle_t rotateEvents=NULL;
+
+//a ring with its own motor driver, sensors and motion. Every ring
+//runs in a task of its own, so both turn at the same time and each
+//stops the moment it is done
+typedef struct {
+    int  motor;                 //TMC2209 driving the ring, 1 or 2
+    EventBits_t done;           //set in rotateEvents when the ring stopped
+    int  (*start)(void);        //returns 0 when the ring doesn't need to turn
+    int  (*step)(void);         //every 10 msec, returns 0 at the target
+    void (*edge)(int pin, int level, int64_t time);
+    void (*lost)(void);         //edges of the sensors got lost
+    int  reached;               //the ring stopped at its target. Read after done
+    sensor_queue_t queue;       //edges of its sensors
+} rotate_axis_t;
+
+static rotate_axis_t hoursAxis = {
+    1, ROTATE_HOURS_DONE, hours_ring_start, hours_ring_step, hours_ring_event, hours_ring_lost
+};
+static rotate_axis_t hourglassAxis = {
+    2, ROTATE_HOURGLASS_DONE, hourglass_start, hourglass_step, hourglass_edge, hourglass_lost
+};
+
+static const sensor_pin_t rotateSensors[] = {
+    { ROTATE_SENSOR1, &hoursAxis.queue },
+    { ROTATE_SENSOR2, &hoursAxis.queue },
+    { ROTATE_SENSOR3, &hoursAxis.queue },
+    { ROTATE_SENSOR4, &hourglassAxis.queue },
+};
+#define ROTATE_SENSORS (sizeof(rotateSensors)/sizeof(rotateSensors[0]))
+
+//handle the sensor edges the interrupt handler queued for a ring
+static void rotate_axis_events(rotate_axis_t *axis) {
+    sensor_queue_t *q=&axis->queue;
+    if(q->overflow) {
+        q->tail=q->head;
+        q->overflow=0;
+        axis->lost();
+    }
+    uint32_t head=q->head;
+    //read the events only after the head that published them
+    __sync_synchronize();
+    while(q->tail!=head) {
+        sensor_event_t *e=&q->events[q->tail&(SENSOR_EVENTS-1)];
+        axis->edge(e->pin, e->level, e->time);
+        //and done with the event before its slot is handed back
+        __sync_synchronize();
+        q->tail++;
+    }
+}
+
+static void rotate_axis_task(void *params) {
+    rotate_axis_t *axis=(rotate_axis_t *)params;
+    axis->reached=0;
+    if(axis->start()) {
+        //rotate max 15 seconds
+        for(int cnt=0; cnt<1500; cnt++) {
+            rotate_axis_events(axis);
+            if(!axis->step()) {
+                axis->reached=1;
+                break;
             }
+            vTaskDelay(10 / portTICK_RATE_MS);
         }
-        cnt++;
-        vTaskDelay(10 / portTICK_RATE_MS);
-    }
-    if(rotate_task_state&0x01) {
-        //Hours ring is still on so the timer is too.
-        //stop the timer now
-        esp_timer_stop(sensors_timer);
+    } else {
+        axis->reached=1;
     }
-    if(hours_ring_velocity>0) {
-        //correct overshoot of hours ring by turning back a little
-        if(hours_ring_direction) tmc2209_rotate_cc(1, 0x4000);
-        else tmc2209_rotate_cw(1, 0x4000);
-        vTaskDelay(200 / portTICK_RATE_MS);
+    //either the ring has reached the target position or it has
+    //taken to long to get there
+    tmc2209_stop(axis->motor);
+    xEventGroupSetBits(rotateEvents, axis->done);
+    vTaskSuspend(NULL);
+}
+
+void rotate_rings_task(void *params) {
+    //Note: charging should be disabled already
+    //Power up motor driver
+    gpio_set_direction((gpio_num_t)VCC2_ENABLE, GPIO_MODE_OUTPUT);
+    gpio_set_level((gpio_num_t)VCC2_ENABLE, 1);
+    //wait a little bit to let vcc2 staiblize
+    vTaskDelay(50 / portTICK_RATE_MS);
+
+    //configure position sensors as input
+    gpio_set_direction((gpio_num_t)ROTATE_SENSOR1, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR1, GPIO_PULLUP_ONLY);
+    gpio_set_direction((gpio_num_t)ROTATE_SENSOR2, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR2, GPIO_PULLUP_ONLY);
+    gpio_set_direction((gpio_num_t)ROTATE_SENSOR3, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR3, GPIO_PULLUP_ONLY);
+    gpio_set_direction((gpio_num_t)ROTATE_SENSOR4, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)ROTATE_SENSOR4, GPIO_PULLUP_ONLY);
+
+    tmc2209_init();
+
+    //queue every edge of the position sensors with its time. The
+    //task of the ring debounces and decodes them every 10 msec
+    hoursAxis.queue.head=hoursAxis.queue.tail=0;
+    hoursAxis.queue.overflow=0;
+    hourglassAxis.queue.head=hourglassAxis.queue.tail=0;
+    hourglassAxis.queue.overflow=0;
+    esp_err_t ret=gpio_install_isr_service(0);
+    if(ret!=ESP_ERR_INVALID_STATE) ESP_ERROR_CHECK(ret); //already installed is fine
+    for(int i=0; i<ROTATE_SENSORS; i++) {
+        gpio_set_intr_type(rotateSensors[i].pin, GPIO_INTR_ANYEDGE);
+        ESP_ERROR_CHECK(gpio_isr_handler_add(rotateSensors[i].pin, sensor_isr, (void *)&rotateSensors[i]));
     }
-    //the rotation loop has ended so either both rings have reached
-    //the target position or it has taken to long to get there
-    //make sure both motors are off
-    tmc2209_stop(1);
-    tmc2209_stop(2);
 
-    //destroy sensors timer
-    ESP_ERROR_CHECK(esp_timer_delete(sensors_timer));
+    //turn both rings and wait till both are done
+    TaskHandle_t hoursTask, hourglassTask;
+    xTaskCreate(&rotate_axis_task, "HoursRing", 2048, &hoursAxis, 5, &hoursTask);
+    xTaskCreate(&rotate_axis_task, "HourglassRing", 2048, &hourglassAxis, 5, &hourglassTask);
+    xEventGroupWaitBits(rotateEvents, ROTATE_HOURS_DONE|ROTATE_HOURGLASS_DONE,
+                        pdTRUE, pdTRUE, portMAX_DELAY);
+    //clear the bits of the rings that got to their target
+    if(hoursAxis.reached) rotate_task_state&=~ROTATE_HOURS_DONE;
+    if(hourglassAxis.reached) rotate_task_state&=~ROTATE_HOURGLASS_DONE;
 
-printf("Rotate task done %d, %d\n", rotate_task_state, cnt);
+    //stop listening to the sensors
+    for(int i=0; i<ROTATE_SENSORS; i++) {
+        gpio_isr_handler_remove(rotateSensors[i].pin);
+        gpio_set_intr_type(rotateSensors[i].pin, GPIO_INTR_DISABLE);
+    }
+
+printf("Rotate task done %d, slip %d.%d%%\n", rotate_task_state,
+             hours_ring_slip()/10, abs(hours_ring_slip()%10));
     //cleanup rotation task
     tmc2209_shutdown();
     gpio_set_level((gpio_num_t)VCC2_ENABLE, 0);
     gpio_set_direction((gpio_num_t)VCC2_ENABLE, GPIO_MODE_INPUT);
+    xEventGroupSetBits(rotateEvents, ROTATE_DONE);
     rotate_task_state=0;
     //vTaskDelete(NULL);
     vTaskSuspend(NULL);
@@ -377,6 +638,8 @@ void rotate_set_time(int hour) {
     //hour actually contains minute while testing
     //minute is always even when we get here.
     //alternate between motors each time this is invoked
+    if(rotateEvents==NULL) rotateEvents=xEventGroupCreate();
+    xEventGroupClearBits(rotateEvents, ROTATE_HOURS_DONE|ROTATE_HOURGLASS_DONE|ROTATE_DONE);
     rotate_task_state=7; //handle both rings and be sure the task can complete
     rotate_task_target=hour;
     if(rotate_task_target==0) rotate_task_target=12;
@@ -389,3 +652,9 @@ void rotate_set_time(int hour) {
 int rotate_busy(void) {
    return rotate_task_state;
 }
+
+//block till the rings are in position and the motors are powered down
+void rotate_wait(void) {
+    if(rotateEvents==NULL) return; //no rotation started
+    xEventGroupWaitBits(rotateEvents, ROTATE_DONE, pdFALSE, pdTRUE, portMAX_DELAY);
+}
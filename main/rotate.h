@@ -3,5 +3,6 @@
 
 void rotate_set_time(int hour);
 int  rotate_busy(void);
+void rotate_wait(void);
 
 #endif
@@ -0,0 +1,17 @@
+#ifndef _ROTATE_CODE_H
+#define _ROTATE_CODE_H
+
+#include <stdint.h>
+
+//generated from rotate_code.txt by tools/rotate_code_gen.py
+
+//hour from the sensor value of the position before times 8 plus the
+//sensor value of the current one, 0 for invalid combinations
+extern const int8_t sensorsMappingCC[64];
+extern const int8_t sensorsMappingCW[64];
+
+//sensor value of every hour. Index 13-19 repeat 1-7 so the position
+//before and after can be looked up with +5 and +7 (-5) hours
+extern const uint8_t expectMap[20];
+
+#endif
@@ -15,6 +15,8 @@
 #include "eink.h"
 #include "bitmaps.h"
 #include "charger.h"
+#include "profile.h"
+#include "storage.h"
 
 extern RTC_NOINIT_ATTR int    coldStart;
 
@@ -36,7 +38,7 @@ static const char TAG[] = "setup";
 //150 2 second ticks. So 5 minutes
 static int rebootWaitCnt = 150;
 
-static char infomessage[2048];
+static char infomessage[6144];
 
 static esp_err_t setup_get_handler(httpd_req_t *req){
         //got a request on the http server. Reset reboot counter
@@ -48,11 +50,14 @@ static esp_err_t setup_get_handler(httpd_req_t *req){
                 char *versionStr = ota_get_app_version();
                 battery_info_t *battery_info = charger_enabled_state();
 
-                sprintf(infomessage, "{\"version\":\"%s\",\"mode\":%d,\"batteries\":[%d,%d,%d,%d,%d],\"state\":%d,\"missed\":%d}",
+                int n = sprintf(infomessage, "{\"version\":\"%s\",\"mode\":%d,\"batteries\":[%d,%d,%d,%d,%d],\"state\":%d,\"missed\":%d,\"profile\":",
                      versionStr, battery_info->mode,
                      battery_info->v1, battery_info->v2, battery_info->v3,
                      battery_info->v4, battery_info->v5,
                      battery_info->state, battery_info->missed_count);
+                //active time statistics of the wake cycles before setup mode
+                n += profile_json(infomessage+n, sizeof(infomessage)-n-2);
+                strcpy(infomessage+n, "}");
 
                 httpd_resp_set_status(req, "200 OK");
                 httpd_resp_set_type(req, "application/json");
@@ -119,6 +124,7 @@ void cb_connection_ok(void *pvParameter){
 }
 
 void setup(void) {
+    ESP_ERROR_CHECK( storage_init() );
     //Clear RTC when entering setup
     //This way the clock will have a clean start
     //when it reboots after a crash in the setup module
@@ -163,6 +169,8 @@ void setup(void) {
         wifi_manager_set_callback(WM_EVENT_STA_GOT_IP, &cb_connection_ok);
     }
     eink_start();
+    //the wiring may have changed. Find the fastest SPI clock again
+    storage_set_u32(STORAGE_EINK_SPI_CLOCK, eink_calibrate_spi());
     eink_init(1);
     eink_display_setup(versionStr, ipaddress, ssid);
     eink_update(1);
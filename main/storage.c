@@ -0,0 +1,57 @@
+/* storage.c
+ * Lazy initialization of the NVS flash.
+ * Only the time sync and setup mode need NVS (wifi configuration
+ * and the wifi driver itself). Initializing NVS scans all NVS pages
+ * in flash which takes about 14 msec, so the normal minute wakes
+ * don't touch it at all. Invoke storage_init() before using NVS.
+ * The clock keeps its own settings in the "hourglass" namespace.
+ */
+#include "esp_log.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "storage.h"
+#include "profile.h"
+
+static const char *TAG = "storage";
+
+#define STORAGE_NAMESPACE "hourglass"
+
+static int initialized = 0;
+
+esp_err_t storage_init(void) {
+    if(initialized) return ESP_OK;
+    int phase = profile_phase(PROFILE_NVS);
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        //NVS partition is full or was written by a newer version
+        //erase it and start over. The wifi configuration is lost.
+        ESP_LOGW(TAG, "Erasing NVS (%d)", err);
+        err = nvs_flash_erase();
+        if(err == ESP_OK) err = nvs_flash_init();
+    }
+    if(err == ESP_OK) initialized = 1;
+    profile_phase(phase);
+    return err;
+}
+
+//value of key, or def when it was never stored
+uint32_t storage_get_u32(const char *key, uint32_t def) {
+    nvs_handle_t handle;
+    uint32_t value = def;
+    if(storage_init()!=ESP_OK) return def;
+    if(nvs_open(STORAGE_NAMESPACE, NVS_READONLY, &handle)!=ESP_OK) return def;
+    if(nvs_get_u32(handle, key, &value)!=ESP_OK) value = def;
+    nvs_close(handle);
+    return value;
+}
+
+esp_err_t storage_set_u32(const char *key, uint32_t value) {
+    nvs_handle_t handle;
+    esp_err_t err = storage_init();
+    if(err == ESP_OK) err = nvs_open(STORAGE_NAMESPACE, NVS_READWRITE, &handle);
+    if(err != ESP_OK) return err;
+    err = nvs_set_u32(handle, key, value);
+    if(err == ESP_OK) err = nvs_commit(handle);
+    nvs_close(handle);
+    return err;
+}
@@ -0,0 +1,14 @@
+#ifndef _STORAGE_H
+#define _STORAGE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+//keys of the settings kept by the clock itself
+#define STORAGE_EINK_SPI_CLOCK "eink_spi_hz"
+
+esp_err_t storage_init(void);
+uint32_t  storage_get_u32(const char *key, uint32_t def);
+esp_err_t storage_set_u32(const char *key, uint32_t value);
+
+#endif
@@ -0,0 +1,211 @@
+/* waveform.c
+ * Waveforms (LUTs) of the e-ink display and which one to use.
+ * A short waveform keeps the display busy for less time, but it
+ * leaves more ghosting behind and it is only good for a limited
+ * temperature range because the ink moves slower in the cold. So
+ * every update takes the first waveform of the table that fits the
+ * update type, the temperature and the number of times it was used
+ * in a row. The last waveform of an update type has no limits.
+ *
+ * The temperature is measured by the display on full updates of the
+ * whole screen (on the hour, when the icons change and every 10
+ * minutes with a ghosting budget of 0). Partial and regional updates
+ * use the last measured temperature.
+ */
+#include <stddef.h>
+#include "esp_attr.h"
+#include "waveform.h"
+#include "eink.h"
+
+//Wave form for partial update for Heltec 1.54 200x200 pixels
+//Kept in DRAM so the SPI driver can DMA it without a bounce buffer
+static DRAM_ATTR const uint8_t WF_PARTIAL[WAVEFORM_LUT_SIZE] = {
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x6,0x0,0x0,0x0,0x0,0x0,0x1,
+0x1,0x1,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x02,0x17,0x41,0xB0,0x32,0x28
+};
+
+#ifdef CONFIG_EINK_CLEAN_PARTIAL_WAVEFORM
+//Partial update that drives the changed pixels about twice as long
+//(30 instead of 12 frames in group 0). Used when the fast one leaves
+//too much ghosting behind or it is too cold for it. Not measured on
+//the display yet, so it is only used with the Kconfig option
+static DRAM_ATTR const uint8_t WF_PARTIAL_CLEAN[WAVEFORM_LUT_SIZE] = {
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xA,0x0,0x0,0x0,0x0,0x0,0x2,
+0x1,0x1,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x02,0x17,0x41,0xB0,0x32,0x28
+};
+#endif
+
+//Full update for room temperature. Flashes the screen 3 times in
+//74 frames, against well over 4 seconds for the OTP waveform
+static DRAM_ATTR const uint8_t WF_FULL[WAVEFORM_LUT_SIZE] = {
+0x80,0x48,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x48,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x48,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x48,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xA,0x0,0x0,0x0,0x0,0x0,0x0,
+0x8,0x1,0x0,0x8,0x1,0x0,0x2,
+0xA,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x22,0x17,0x41,0x0,0x32,0x20
+};
+
+#ifdef CONFIG_EINK_REGIONAL_WAVEFORM
+//Full update for a window of the display RAM. It runs in display
+//mode 2 like a partial update, so the driver writes the inverse of
+//the new image into the red RAM of the window: every pixel in it gets
+//the full drive of WF_FULL (LUT1 to white, LUT2 to black) while the
+//pixels outside the window keep red == BW and are not driven at all
+//(LUT0 and LUT3 empty). Used to clean up the digits without flashing
+//the icons. Not measured on the display yet, so it is only used with
+//the Kconfig option. Without it the digits get a full update
+static DRAM_ATTR const uint8_t WF_REGIONAL[WAVEFORM_LUT_SIZE] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x48,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x48,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xA,0x0,0x0,0x0,0x0,0x0,0x0,
+0x8,0x1,0x0,0x8,0x1,0x0,0x2,
+0xA,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x22,0x17,0x41,0x0,0x32,0x20
+};
+#endif
+
+//maxUses counts partial updates since the last full update for the
+//partial waveforms and fast full updates since the last deghosting
+//one for the full waveforms. A forced full update (after a reset, a
+//time sync or on the hour) always deghosts. The ghosting of the
+//partial waveforms counts against CONFIG_EINK_GHOST_BUDGET. There is
+//no regional full update outside its temperature range or without
+//CONFIG_EINK_REGIONAL_WAVEFORM (no LUT), the driver does a full update
+//instead. Only full updates can use the OTP waveform
+const waveform_t waveforms[WAVEFORM_KINDS] = {
+#ifdef CONFIG_EINK_CLEAN_PARTIAL_WAVEFORM
+    [WAVEFORM_FAST_PARTIAL]  = { "fast_partial",  WF_PARTIAL,       EINK_PARTIAL,    10,  40, 12, 2 },
+    [WAVEFORM_CLEAN_PARTIAL] = { "clean_partial", WF_PARTIAL_CLEAN, EINK_PARTIAL,  -128, 127,  0, 1 },
+#else
+    //every partial update uses the known waveform
+    [WAVEFORM_FAST_PARTIAL]  = { "fast_partial",  WF_PARTIAL,       EINK_PARTIAL,  -128, 127,  0, 2 },
+    [WAVEFORM_CLEAN_PARTIAL] = { "clean_partial", WF_PARTIAL,       EINK_PARTIAL,  -128, 127,  0, 2 },
+#endif
+#ifdef CONFIG_EINK_REGIONAL_WAVEFORM
+    [WAVEFORM_REGIONAL_FULL] = { "regional_full", WF_REGIONAL,      EINK_REGIONAL,   10,  40,  0, 0 },
+#else
+    [WAVEFORM_REGIONAL_FULL] = { "regional_full", NULL,             EINK_REGIONAL,   10,  40,  0, 0 },
+#endif
+    [WAVEFORM_FAST_FULL]     = { "fast_full",     WF_FULL,          EINK_FULL,       10,  40,  5, 0 },
+    [WAVEFORM_DEGHOST_FULL]  = { "deghost_full",  NULL,             EINK_FULL,     -128, 127,  0, 0 },
+};
+
+RTC_DATA_ATTR static int8_t  temperature = WAVEFORM_TEMP_UNKNOWN;
+RTC_DATA_ATTR static uint8_t partials = 0;   //partial updates since the last full update
+RTC_DATA_ATTR static uint8_t fastFulls = 0;  //fast full updates since the last deghosting one
+
+//temperature in degrees C as measured by the display
+void waveform_temperature(int celsius) {
+    if(celsius<-127) celsius = -127;
+    if(celsius>127) celsius = 127;
+    temperature = (int8_t)celsius;
+}
+
+int waveform_get_temperature(void) {
+    return temperature;
+}
+
+//the waveform for the next update (EINK_PARTIAL, EINK_REGIONAL or
+//EINK_FULL). An update below 0 forces a full update that removes all
+//ghosting. Returns WAVEFORM_NONE if no regional waveform fits
+int waveform_select(int update) {
+    int uses = (update==EINK_FULL)?fastFulls:partials;
+    if(update<0) {
+        update = EINK_FULL;
+        uses = 255;
+    }
+    for(int i=0; i<WAVEFORM_KINDS; i++) {
+        const waveform_t *w = &waveforms[i];
+        if(w->update!=update) continue;
+        if(w->lut==NULL && update!=EINK_FULL) continue;
+        if(w->maxUses && uses>=w->maxUses) continue;
+        //waveforms with a limited range need a known temperature
+        if(w->minTemp>-128 && temperature==WAVEFORM_TEMP_UNKNOWN) continue;
+        if(temperature<w->minTemp || temperature>w->maxTemp) continue;
+        return i;
+    }
+    if(update==EINK_REGIONAL) return WAVEFORM_NONE;
+    return (update==EINK_FULL)?WAVEFORM_DEGHOST_FULL:WAVEFORM_CLEAN_PARTIAL;
+}
+
+//the display was updated with waveform
+void waveform_used(int waveform) {
+    switch(waveform) {
+    case WAVEFORM_FAST_PARTIAL:
+    case WAVEFORM_CLEAN_PARTIAL:
+        if(partials<255) partials++;
+        break;
+    case WAVEFORM_REGIONAL_FULL:
+        partials = 0;
+        break;
+    case WAVEFORM_FAST_FULL:
+        partials = 0;
+        if(fastFulls<255) fastFulls++;
+        break;
+    case WAVEFORM_DEGHOST_FULL:
+        partials = 0;
+        fastFulls = 0;
+        break;
+    }
+}
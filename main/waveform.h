@@ -0,0 +1,39 @@
+#ifndef _WAVEFORM_H
+#define _WAVEFORM_H
+
+#include <stdint.h>
+
+//waveforms of the display, fastest first per update type
+#define WAVEFORM_FAST_PARTIAL   0
+#define WAVEFORM_CLEAN_PARTIAL  1
+#define WAVEFORM_REGIONAL_FULL  2
+#define WAVEFORM_FAST_FULL      3
+#define WAVEFORM_DEGHOST_FULL   4
+#define WAVEFORM_KINDS          5
+#define WAVEFORM_NONE        0xFF
+
+//temperature before the display measured it
+#define WAVEFORM_TEMP_UNKNOWN (-128)
+
+//153 bytes for register 0x32 followed by the end option (0x3F),
+//gate (0x03), source (0x04) and VCOM (0x2C) voltages
+#define WAVEFORM_LUT_SIZE 159
+
+typedef struct {
+    const char    *name;
+    const uint8_t *lut;     //NULL: the OTP waveform for the measured temperature
+    uint8_t  update;        //EINK_PARTIAL, EINK_REGIONAL or EINK_FULL
+    int8_t   minTemp;       //degrees C the waveform is good for
+    int8_t   maxTemp;
+    uint8_t  maxUses;       //in a row, see waveform_select. 0 for no limit
+    uint8_t  ghosting;      //left in a region by a partial update
+} waveform_t;
+
+extern const waveform_t waveforms[WAVEFORM_KINDS];
+
+void waveform_temperature(int celsius);
+int  waveform_get_temperature(void);
+int  waveform_select(int fullUpdate);
+void waveform_used(int waveform);
+
+#endif
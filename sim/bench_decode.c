@@ -0,0 +1,120 @@
+/* bench_decode.c
+ * Host benchmark of the bitmap decoder.
+ * Draws all bitmaps (digits, bitmaps and font tables) into the image
+ * buffer with eink_draw_bitmap, which decodes the run length encoded
+ * tokens of bitmaps_packed.c, and with a copy of the plain arrays that
+ * tools/bitmap_gen.py --raw writes, one memcpy per vertical line like
+ * the driver did before the encoding. Both must give the same image
+ * buffer. Prints the time per bitmap of both on the host clock.
+ *
+ * usage: bench_decode [rounds]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+
+//eink_draw_bitmap and the image buffer are static
+#include "../main/eink.c"
+
+//the same tables from bitmaps_raw.c
+extern const uint8_t *raw_digits[];
+extern const uint8_t *raw_bitmaps[];
+extern const uint8_t *raw_font[];
+
+sim_world_t *sim;
+int sim_verbose=0;
+
+void sim_note_cycle(int cycle) {
+}
+
+void sim_rtc_save(void) {
+}
+
+void sim_wake_end(int64_t sleepUs) {
+    exit(1);
+}
+
+#define BENCH_HEIGHT 25     //bytes per line of the image buffer
+
+typedef struct {
+    const char *name;
+    const uint8_t **packed;
+    const uint8_t **raw;
+    int count;
+} bench_table_t;
+
+static const bench_table_t tables[] = {
+    { "digits",  digits,  raw_digits,  10 },
+    { "bitmaps", bitmaps, raw_bitmaps, BITMAP_SQUARE+1 },
+    { "font",    font,    raw_font,    126-33+1 },
+};
+
+#define BENCH_TABLES (int)(sizeof(tables)/sizeof(tables[0]))
+
+//the plain copy, at the top right of the buffer like the decoder below
+static void bench_copy(const uint8_t *bitmap) {
+    uint8_t bitmapWidth = *bitmap++;
+    uint8_t bitmapHeight = *bitmap++;
+    uint8_t *p = imageBuffer;
+    for(int x=0; x<bitmapWidth; x++) {
+        memcpy(p, bitmap, bitmapHeight);
+        bitmap += bitmapHeight;
+        p += BENCH_HEIGHT;
+    }
+}
+
+static void bench_decode(const uint8_t *bitmap) {
+    eink_draw_bitmap(bitmap, 0, 0, 200, BENCH_HEIGHT);
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec+ts.tv_nsec*1e-9;
+}
+
+//µs per bitmap of draw over the table
+static double bench_time(void (*draw)(const uint8_t *), const uint8_t **table, int count, int rounds) {
+    double start=bench_now();
+    for(int r=0; r<rounds; r++) {
+        for(int i=0; i<count; i++) draw(table[i]);
+    }
+    return (bench_now()-start)*1e6/((double)rounds*count);
+}
+
+int main(int argc, char **argv) {
+    int rounds=argc>1?atoi(argv[1]):20000;
+    if(rounds<1) rounds=1;
+
+    //both must draw the same
+    static uint8_t copied[sizeof(imageBuffer)];
+    for(int t=0; t<BENCH_TABLES; t++) {
+        for(int i=0; i<tables[t].count; i++) {
+            memset(imageBuffer, 0x5A, sizeof(imageBuffer));
+            bench_copy(tables[t].raw[i]);
+            memcpy(copied, imageBuffer, sizeof(imageBuffer));
+            memset(imageBuffer, 0x5A, sizeof(imageBuffer));
+            bench_decode(tables[t].packed[i]);
+            if(memcmp(copied, imageBuffer, sizeof(imageBuffer))!=0) {
+                fprintf(stderr, "%s[%d] decodes to other bytes than the raw array\n",
+                        tables[t].name, i);
+                return 1;
+            }
+        }
+    }
+
+    printf("table     count  decode us  copy us  (per bitmap, %d rounds)\n", rounds);
+    double decodeSum=0, copySum=0;
+    int total=0;
+    for(int t=0; t<BENCH_TABLES; t++) {
+        double d=bench_time(bench_decode, tables[t].packed, tables[t].count, rounds);
+        double c=bench_time(bench_copy, tables[t].raw, tables[t].count, rounds);
+        printf("%-8s %6d %10.3f %8.3f\n", tables[t].name, tables[t].count, d, c);
+        decodeSum+=d*tables[t].count;
+        copySum+=c*tables[t].count;
+        total+=tables[t].count;
+    }
+    printf("%-8s %6d %10.3f %8.3f\n", "all", total, decodeSum/total, copySum/total);
+    return 0;
+}
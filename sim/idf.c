@@ -0,0 +1,225 @@
+/* idf.c
+ * Stand-ins for the remaining esp-idf functions used on the wake path:
+ * logging, reset and sleep, NVS, wifi, SNTP, OTA and the ULP.
+ * The setup mode is not simulated.
+ */
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_event.h"
+#include "esp_sntp.h"
+#include "esp_ota_ops.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "wifi.h"
+#include "setup.h"
+#include "ulp_utils.h"
+#include "sim.h"
+#include "model.h"
+
+void sim_log(char level, const char *tag, const char *format, ...) {
+    if(!sim_verbose) return;
+    va_list args;
+    va_start(args, format);
+    printf("%c (%lld) %s: ", level, (long long)((sim_now()-sim_wake_start())/1000), tag);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+//time as kept by the RTC of the ESP
+time_t sim_time(time_t *t) {
+    time_t now=(time_t)((sim->now+sim->rtcOffset)/1000000);
+    if(t) *t=now;
+    return now;
+}
+
+int sim_gettimeofday(struct timeval *tv, void *tz) {
+    int64_t now=sim->now+sim->rtcOffset;
+    tv->tv_sec=(time_t)(now/1000000);
+    tv->tv_usec=(suseconds_t)(now%1000000);
+    return 0;
+}
+
+esp_reset_reason_t esp_reset_reason(void) {
+    return sim->resetReason;
+}
+
+void esp_restart(void) {
+    sim->resetReason=ESP_RST_SW;
+    sim_wake_end(0);
+}
+
+uint32_t esp_random(void) {
+    return (uint32_t)random();
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void) {
+    return sim->wakeupCause;
+}
+
+static int64_t lightSleepTimer=-1;  //timer wake up of light sleep
+static int lightSleepGpio=0;
+
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t mask, esp_sleep_ext1_wakeup_mode_t mode) {
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    lightSleepTimer=(int64_t)time_in_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup(void) {
+    lightSleepGpio=1;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+    if(source==ESP_SLEEP_WAKEUP_TIMER || source==ESP_SLEEP_WAKEUP_ALL) lightSleepTimer=-1;
+    if(source==ESP_SLEEP_WAKEUP_GPIO || source==ESP_SLEEP_WAKEUP_ALL) lightSleepGpio=0;
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start(void) {
+    sim_spend(SIM_LIGHT_SLEEP_ENTER_US);
+    int64_t wake=INT64_MAX;
+    if(lightSleepTimer>=0) wake=sim_now()+lightSleepTimer;
+    if(lightSleepGpio) {
+        int64_t t=sim_gpio_wakeup_at();
+        if(t<wake) wake=t;
+    }
+    if(wake==INT64_MAX) {
+        fprintf(stderr, "light sleep without wake up source\n");
+        abort();
+    }
+    sim_light_sleep(wake);
+    sim_spend(SIM_LIGHT_SLEEP_WAKE_US);
+    return ESP_OK;
+}
+
+void esp_deep_sleep(uint64_t time_in_us) {
+    sim_wake_end(time_in_us);
+}
+
+esp_err_t nvs_flash_init(void) {
+    sim_spend(SIM_NVS_INIT_US);
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void) {
+    memset(sim->nvs, 0, sizeof(sim->nvs));
+    return ESP_OK;
+}
+
+//a single namespace is enough for the firmware
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle) {
+    *out_handle=1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out_value) {
+    for(int i=0; i<SIM_NVS_KEYS; i++) {
+        if(strcmp(sim->nvs[i].key, key)==0) {
+            *out_value=sim->nvs[i].value;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value) {
+    for(int i=0; i<SIM_NVS_KEYS; i++) {
+        if(sim->nvs[i].key[0]==0 || strcmp(sim->nvs[i].key, key)==0) {
+            snprintf(sim->nvs[i].key, sizeof(sim->nvs[i].key), "%s", key);
+            sim->nvs[i].value=value;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+}
+
+esp_err_t esp_event_loop_create_default(void) {
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_init(void) {
+    return ESP_OK;
+}
+
+esp_err_t esp_ota_mark_app_valid_cancel_rollback(void) {
+    return ESP_OK;
+}
+
+void wifi_init_sta(void) {
+    sim_note_cycle(SIM_CYCLE_SYNC);
+    sim_set_load(SIM_LOAD_WIFI, SIM_WIFI_MA);
+    sim_task_delay(SIM_WIFI_CONNECT_US);
+}
+
+void wifi_stop_sta(void) {
+    sim_spend(SIM_WIFI_STOP_US);
+    sim_set_load(SIM_LOAD_WIFI, 0);
+}
+
+static int64_t sntpStart=-1;
+static sntp_sync_time_cb_t sntpCallback=NULL;
+
+void sntp_setoperatingmode(unsigned char operating_mode) {
+}
+
+void sntp_setservername(unsigned char idx, const char *server) {
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    sntpCallback=callback;
+}
+
+void sntp_init(void) {
+    sntpStart=sim_now();
+}
+
+void sntp_stop(void) {
+    sntpStart=-1;
+}
+
+sntp_sync_status_t sntp_get_sync_status(void) {
+    if(sntpStart<0 || sim_now()-sntpStart<SIM_SNTP_US) return SNTP_SYNC_STATUS_RESET;
+    //set the RTC to the true time
+    sim->rtcOffset=sim->epoch*1000000LL;
+    if(sntpCallback) {
+        struct timeval tv;
+        sim_gettimeofday(&tv, NULL);
+        sntpCallback(&tv);
+    }
+    sntpStart=-1;
+    return SNTP_SYNC_STATUS_COMPLETED;
+}
+
+uint32_t ulp_entry;
+
+void ulp_init() {
+}
+
+void ulp_start() {
+    sim_panel_ulp_sleep();
+}
+
+void setup(void) {
+    fprintf(stderr, "setup mode is not simulated\n");
+    abort();
+}
@@ -0,0 +1,35 @@
+/* spi_slave.h
+ * Stand-in for the esp-idf spi slave driver.
+ * The charger module model answers with its battery packets.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/spi_common.h"
+
+typedef struct spi_slave_transaction_t {
+    size_t length;
+    size_t trans_len;
+    const void *tx_buffer;
+    void *rx_buffer;
+    void *user;
+} spi_slave_transaction_t;
+
+typedef void (*slave_transaction_cb_t)(spi_slave_transaction_t *trans);
+
+typedef struct {
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    uint8_t mode;
+    slave_transaction_cb_t post_setup_cb;
+    slave_transaction_cb_t post_trans_cb;
+} spi_slave_interface_config_t;
+
+esp_err_t spi_slave_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, const spi_slave_interface_config_t *slave_config, int dma_chan);
+esp_err_t spi_slave_free(spi_host_device_t host);
+esp_err_t spi_slave_queue_trans(spi_host_device_t host, const spi_slave_transaction_t *trans_desc, TickType_t ticks_to_wait);
+esp_err_t spi_slave_get_trans_result(spi_host_device_t host, spi_slave_transaction_t **trans_desc, TickType_t ticks_to_wait);
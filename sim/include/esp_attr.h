@@ -0,0 +1,15 @@
+/* esp_attr.h
+ * Stand-in for the esp-idf memory attributes.
+ * RTC variables are collected in their own sections. The simulation
+ * copies these sections in and out of the child process of every wake
+ * so they survive deep sleep while all other variables do not.
+ */
+#pragma once
+
+#define RTC_DATA_ATTR   __attribute__((section("rtc_data")))
+#define RTC_NOINIT_ATTR __attribute__((section("rtc_noinit")))
+#define RTC_FAST_ATTR   __attribute__((section("rtc_data")))
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
+#define DMA_ATTR        WORD_ALIGNED_ATTR DRAM_ATTR
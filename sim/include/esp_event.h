@@ -0,0 +1,9 @@
+/* esp_event.h
+ * Stand-in for the esp-idf default event loop and netif
+ */
+#pragma once
+
+#include "esp_err.h"
+
+esp_err_t esp_event_loop_create_default(void);
+esp_err_t esp_netif_init(void);
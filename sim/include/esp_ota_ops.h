@@ -0,0 +1,8 @@
+/* esp_ota_ops.h
+ * Stand-in for the esp-idf OTA functions used on the wake path
+ */
+#pragma once
+
+#include "esp_err.h"
+
+esp_err_t esp_ota_mark_app_valid_cancel_rollback(void);
@@ -0,0 +1,8 @@
+/* esp_rom_sys.h
+ * Stand-in for the esp-idf ROM system functions
+ */
+#pragma once
+
+#include <stdint.h>
+
+void esp_rom_delay_us(uint32_t us);
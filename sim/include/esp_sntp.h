@@ -0,0 +1,25 @@
+/* esp_sntp.h
+ * Stand-in for the esp-idf SNTP client.
+ * A sync sets the RTC to the true virtual time.
+ */
+#pragma once
+
+#include <sys/time.h>
+#include "esp_err.h"
+
+typedef enum {
+    SNTP_SYNC_STATUS_RESET,
+    SNTP_SYNC_STATUS_COMPLETED,
+    SNTP_SYNC_STATUS_IN_PROGRESS,
+} sntp_sync_status_t;
+
+#define SNTP_OPMODE_POLL 0
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+void sntp_setoperatingmode(unsigned char operating_mode);
+void sntp_setservername(unsigned char idx, const char *server);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+void sntp_init(void);
+void sntp_stop(void);
+sntp_sync_status_t sntp_get_sync_status(void);
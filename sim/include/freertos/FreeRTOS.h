@@ -0,0 +1,36 @@
+/* FreeRTOS.h
+ * Stand-in for FreeRTOS on top of the cooperative scheduler
+ * of the simulation. Tasks only switch when they block.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <assert.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS ((TickType_t)(1000 / CONFIG_FREERTOS_HZ))
+#define portTICK_RATE_MS   portTICK_PERIOD_MS
+#define pdMS_TO_TICKS(ms)  ((TickType_t)((ms) * CONFIG_FREERTOS_HZ / 1000))
+
+//tasks only switch when they block, so an ISR never preempts
+#define portYIELD_FROM_ISR()
+
+#define BIT0  0x00000001
+#define BIT1  0x00000002
+#define BIT2  0x00000004
+#define BIT3  0x00000008
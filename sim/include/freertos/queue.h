@@ -0,0 +1,8 @@
+/* queue.h
+ * Stand-in for the FreeRTOS queue api
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_queue *QueueHandle_t;
@@ -0,0 +1,17 @@
+/* task.h
+ * Stand-in for the FreeRTOS task api
+ */
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char *pcName,
+                       uint32_t usStackDepth, void *pvParameters,
+                       UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask);
+void vTaskDelay(const TickType_t xTicksToDelay);
+void vTaskSuspend(TaskHandle_t xTaskToSuspend);
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+TickType_t xTaskGetTickCount(void);
@@ -0,0 +1,9 @@
+/* nvs_flash.h
+ * Stand-in for the esp-idf NVS flash initialization
+ */
+#pragma once
+
+#include "esp_err.h"
+
+esp_err_t nvs_flash_init(void);
+esp_err_t nvs_flash_erase(void);
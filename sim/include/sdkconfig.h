@@ -0,0 +1,14 @@
+/* sdkconfig.h
+ * Stand-in for the generated sdkconfig.h.
+ * Only the settings used by the firmware sources are defined.
+ */
+#pragma once
+
+#define CONFIG_IDF_TARGET_ESP32 1
+#define CONFIG_FREERTOS_HZ 100
+#define CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ 80
+#define CONFIG_LOG_DEFAULT_LEVEL 2
+#define CONFIG_EINK_BUSY_TIMEOUT 7000
+#ifndef CONFIG_EINK_GHOST_BUDGET
+#define CONFIG_EINK_GHOST_BUDGET 24
+#endif
@@ -0,0 +1,9 @@
+/* ulp_main.h
+ * Stand-in for the header generated from the ULP program.
+ * The simulation handles the ULP power down of the panel itself.
+ */
+#pragma once
+
+#include <stdint.h>
+
+extern uint32_t ulp_entry;
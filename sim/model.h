@@ -0,0 +1,85 @@
+/* model.h
+ * Timing and current figures used by the host simulation.
+ * These are estimates. The currents are the ones measured on the
+ * clock (see README.md), the timings are taken from the datasheets
+ * where possible and tuned so a partial update takes about 175 msec
+ * and a full update a little over 200 msec, like on the real clock.
+ */
+#ifndef _MODEL_H
+#define _MODEL_H
+
+//wiring, must match the firmware
+#define PIN_EINK_BUSY       4
+#define PIN_EINK_RST        5
+#define PIN_EINK_DC        27
+#define PIN_EINK_CS        26
+#define PIN_VCC2_ENABLE     2
+#define PIN_CHARGER_WAKE   23
+#define PIN_CHARGER_MOSI   36
+#define PIN_CHARGER_SCK    35
+#define PIN_MOTOR1_EN      17
+#define PIN_MOTOR2_EN      16
+#define PIN_SENSOR1        22
+#define PIN_SENSOR2        21
+#define PIN_SENSOR3        13
+#define PIN_SENSOR4        14
+
+//currents
+#define SIM_CPU_MA          38.0    //ESP32 active at 80MHz
+#define SIM_WIFI_MA         80.0    //additional current when the radio is on
+#define SIM_DEEP_SLEEP_UA   85.0    //complete circuit in deep sleep
+#define SIM_PANEL_MA         2.0    //e-ink display while updating
+#define SIM_PANEL_IDLE_UA   19.0    //e-ink display awake but idle, above deep sleep
+#define SIM_ULP_UA         100.0    //ULP waiting for the display
+#define SIM_LIGHT_SLEEP_MA   0.8    //ESP32 in light sleep
+
+//ESP32 timing
+#define SIM_BOOT_US        140000   //ROM, 2nd stage bootloader and startup till app_main
+#define SIM_NVS_INIT_US     14000   //nvs_flash_init scanning all NVS pages
+#define SIM_GPIO_US             2   //gpio_reset_pin and friends
+#define SIM_SPI_BUS_INIT_US   180   //spi_bus_initialize including DMA channel
+#define SIM_SPI_ADD_DEV_US     60   //spi_bus_add_device
+#define SIM_SPI_TRANS_US        8   //setup of a polling transaction
+#define SIM_SPI_LOCK_US         4   //bus lock of a transaction, unless the bus is acquired
+#define SIM_SPI_DMA_US          3   //DMA descriptors of a transaction from tx_buffer
+#define SIM_SPI_QUEUE_US       25   //setup of a queued (interrupt) transaction
+#define SIM_UART_INSTALL_US   150   //uart_driver_install and configuration
+#define SIM_UART_WRITE_US      10   //uart_write_bytes of one datagram
+#define SIM_TIMER_CB_US         3   //esp_timer dispatch of one callback
+#define SIM_ISR_INSTALL_US     20   //gpio_install_isr_service
+#define SIM_ISR_US              5   //gpio interrupt dispatch and handler
+#define SIM_LIGHT_SLEEP_ENTER_US 150 //esp_light_sleep_start till the cpu stops
+#define SIM_LIGHT_SLEEP_WAKE_US  400 //wake up till the task runs again
+#define SIM_WIFI_CONNECT_US 1800000 //wifi start, association and dhcp
+#define SIM_WIFI_STOP_US    30000
+#define SIM_SNTP_US         300000  //first answer from pool.ntp.org
+#define SIM_CHARGER_REPLY_US 20000  //charger module wakes up and measures
+#define SIM_WAKE_LIMIT_US   60000000 //a wake taking longer is a hang
+
+//SSD1681 timing
+#define SIM_PANEL_HWRESET_US    1000
+#define SIM_PANEL_SWRESET_US    3000
+#define SIM_PANEL_CLOCK_US      2000 //enable/disable clock and analog
+#define SIM_PANEL_LOADTEMP_US   3000
+#define SIM_PANEL_LOADLUT_US   12000 //load LUT from OTP
+#define SIM_PANEL_FRAME_US     20000 //one frame of a custom waveform
+#define SIM_PANEL_READ_MAX_HZ 2500000 //SCL in read mode, see -S for writes
+#define SIM_PANEL_AUTOWRITE_US  1000 //auto write of a ram (0x46/0x47), estimate, not in the datasheet
+#define SIM_PANEL_OTP_FULL_US 4200000 //the low temperature OTP waveform
+
+//ring mechanics
+#define SIM_HOURS_SLOT_MM         90.0  //distance between two hour positions
+#define SIM_HOURS_MM_PER_S       125.0  //hours ring at a VACTUAL of 0x18000
+#define SIM_HOURS_FULL_SPEED   0x18000
+#define SIM_MAGNET_RADIUS_MM       6.0  //sensor active within this distance
+#define SIM_HOURS_COAST_MM_S2   2000.0  //deceleration of the released ring, estimate
+#define SIM_HOURGLASS_S           3.0   //half turn at a VACTUAL of 0x10000
+#define SIM_HOURGLASS_SPEED    0x10000
+#define SIM_HOURGLASS_WIDTH       0.02  //sensor active part of a half turn
+
+//charger module reply (3 battery mode, all batteries well charged)
+#define SIM_BATTERY_V1   395     //ESP battery in 10mV
+#define SIM_BATTERY_V2   390     //motor battery 1
+#define SIM_BATTERY_V3   780     //motor battery 1 and 2 in series
+
+#endif
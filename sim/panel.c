@@ -0,0 +1,285 @@
+/* panel.c
+ * Model of the SSD1681 controller of the 1.54" e-ink display.
+ * It keeps both RAM buffers, the ram window and pointers and the
+ * LUT state, so the image on screen can be checked after every update.
+ * The BUSY line follows the timing of the commands that take time.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+#include "model.h"
+
+#define P (sim->panel)
+
+static void sim_panel_defaults(void) {
+    P.lutLoaded=0;
+    P.pingpong=0;
+    P.entryMode=0x03;
+    P.xStart=0; P.xEnd=24;
+    P.yStart=0; P.yEnd=199;
+    P.x=0; P.y=0;
+    P.ramTarget=0;
+    P.updateOption=0xFF;
+    P.readRed=0;
+    P.tempReg=0x7FF;
+}
+
+static void sim_panel_busy_for(int64_t us) {
+    int64_t start=sim_now()>P.busyUntil?sim_now():P.busyUntil;
+    P.busyUntil=start+us;
+    sim->panelBusyUs+=us;
+    sim->panelUAs+=SIM_PANEL_MA*(double)us/1000.0;
+}
+
+static uint32_t sim_panel_hash(const uint8_t *p, int len) {
+    //FNV-1a
+    uint32_t h=2166136261u;
+    for(int i=0; i<len; i++) {
+        h^=p[i];
+        h*=16777619u;
+    }
+    return h;
+}
+
+//number of frames of the custom waveform in the LUT register
+static int sim_panel_lut_frames(void) {
+    int frames=0;
+    for(int g=0; g<12; g++) {
+        const uint8_t *tp=&P.lut[60+g*7];
+        frames+=(tp[6]+1)*((tp[0]+tp[1])*(tp[2]+1)+(tp[3]+tp[4])*(tp[5]+1));
+    }
+    return frames;
+}
+
+void sim_panel_rst(int level) {
+    if(!P.rstLevel && level) {
+        //rising edge of the reset line. Wakes from deep sleep
+        P.sleeping=0;
+        sim_panel_defaults();
+        sim_panel_busy_for(SIM_PANEL_HWRESET_US);
+    }
+    P.rstLevel=level;
+}
+
+int sim_panel_busy(void) {
+    return sim_now()<P.busyUntil;
+}
+
+void sim_panel_ulp_sleep(void) {
+    //the ULP polls BUSY every 32 msec and sends deep sleep mode 1
+    int64_t wait=P.busyUntil-sim_now();
+    if(wait<0) wait=0;
+    wait=(wait/32000+1)*32000;
+    sim->panelUAs+=SIM_ULP_UA*(double)wait/1000000.0;
+    P.sleeping=1;
+}
+
+//auto write of a ram with a regular pattern (0x46/0x47). Blocks of
+//step width pixels by step height gates alternate, starting with the
+//first step value
+static void sim_panel_auto_write(uint8_t *ram, uint8_t option) {
+    static const int steps[8]={ 8, 16, 32, 64, 128, 200, 200, 200 };
+    int height=steps[(option>>4)&0x07];
+    int width=steps[option&0x07];
+    int first=(option&0x80)?1:0;
+    for(int y=0; y<200; y++) {
+        for(int x=0; x<25; x++) {
+            uint8_t b=0;
+            for(int bit=0; bit<8; bit++) {
+                int v=first^(((x*8+bit)/width+y/height)&1);
+                b|=v<<(7-bit);
+            }
+            ram[y*25+x]=b;
+        }
+    }
+    sim_panel_busy_for(SIM_PANEL_AUTOWRITE_US);
+}
+
+//advance the address counter according to the data entry mode
+static void sim_panel_advance(void) {
+    int xinc=(P.entryMode&0x01)?1:-1;
+    int yinc=(P.entryMode&0x02)?1:-1;
+    if(!(P.entryMode&0x04)) {
+        if(P.x==(xinc>0?P.xEnd:P.xStart)) {
+            P.x=(xinc>0)?P.xStart:P.xEnd;
+            if(P.y==(yinc>0?P.yEnd:P.yStart)) P.y=(yinc>0)?P.yStart:P.yEnd;
+            else P.y+=yinc;
+        } else P.x+=xinc;
+    } else {
+        if(P.y==(yinc>0?P.yEnd:P.yStart)) {
+            P.y=(yinc>0)?P.yStart:P.yEnd;
+            if(P.x==(xinc>0?P.xEnd:P.xStart)) P.x=(xinc>0)?P.xStart:P.xEnd;
+            else P.x+=xinc;
+        } else P.y+=yinc;
+    }
+}
+
+static void sim_panel_ram_write(uint8_t b) {
+    uint8_t *ram=(P.ramTarget==0x24)?P.bw:P.red;
+    if(P.x>=0 && P.x<25 && P.y>=0 && P.y<200) ram[P.y*25+P.x]=b;
+    sim_panel_advance();
+}
+
+static void sim_panel_activate(void) {
+    int option=P.updateOption;
+    int64_t us=0;
+    if(option&0xC0) us+=SIM_PANEL_CLOCK_US;
+    if(option&0x20) {
+        //internal sensor. Two's complement in 1/16 degrees
+        us+=SIM_PANEL_LOADTEMP_US;
+        P.tempReg=(int)(sim->temperature*16.0)&0xFFF;
+    }
+    if(option&0x10) {
+        //load the waveform from OTP. Replaces a custom LUT
+        us+=SIM_PANEL_LOADLUT_US;
+        P.lutLoaded=0;
+    }
+    if(option&0x04) {
+        //a custom LUT that drives a pixel the same whatever its red bit
+        //is (LUT0 == LUT2 and LUT1 == LUT3) drives every pixel
+        int redless=P.lutLoaded && memcmp(P.lut, P.lut+24, 12)==0 && memcmp(P.lut+12, P.lut+36, 12)==0;
+        if((option&0x08) && !redless) {
+            //display mode 2. A pixel is driven when its red and bw
+            //bits differ. Normally the red ram holds what is on screen
+            //and the bw ram what it needs to become. A pixel that has
+            //to change but is not driven is a stale red ram. Driven
+            //pixels that don't change make it a regional full update
+            int stale=0, regional=0;
+            for(int i=0; i<SIM_PANEL_RAM; i++) {
+                uint8_t driven=P.red[i]^P.bw[i];
+                uint8_t change=P.screen[i]^P.bw[i];
+                if(change&~driven) stale=1;
+                if(driven&~change) regional=1;
+            }
+            P.staleRed+=stale;
+            if(regional) {
+                P.regionalUpdates++;
+                sim_note_cycle(SIM_CYCLE_FULL);
+            } else {
+                P.partialUpdates++;
+                sim_note_cycle(SIM_CYCLE_PARTIAL);
+            }
+        } else {
+            P.fullUpdates++;
+            sim_note_cycle(SIM_CYCLE_FULL);
+        }
+        if(P.lutLoaded) us+=(int64_t)sim_panel_lut_frames()*SIM_PANEL_FRAME_US;
+        else us+=SIM_PANEL_OTP_FULL_US;
+        memcpy(P.screen, P.bw, SIM_PANEL_RAM);
+        if((option&0x08) && P.pingpong) memcpy(P.red, P.bw, SIM_PANEL_RAM);
+        sim->updates++;
+        sim->screenHash=sim_panel_hash(P.screen, SIM_PANEL_RAM);
+    }
+    if(option&0x03) us+=SIM_PANEL_CLOCK_US;
+    sim_panel_busy_for(us);
+}
+
+static void sim_panel_command(uint8_t cmd) {
+    P.cmd=cmd;
+    P.argc=0;
+    switch(cmd) {
+    case 0x12:
+        //soft reset. Everything back to default except deep sleep
+        sim_panel_defaults();
+        sim_panel_busy_for(SIM_PANEL_SWRESET_US);
+        break;
+    case 0x20:
+        sim_panel_activate();
+        break;
+    case 0x24:
+    case 0x26:
+        P.ramTarget=cmd;
+        break;
+    case 0x32:
+        P.lutLoaded=0;
+        break;
+    }
+}
+
+static void sim_panel_data(uint8_t b) {
+    int n=P.argc++;
+    if(n<(int)sizeof(P.args)) P.args[n]=b;
+    switch(P.cmd) {
+    case 0x10:
+        if(n==0) P.sleeping=b&0x03;
+        break;
+    case 0x11:
+        if(n==0) P.entryMode=b&0x07;
+        break;
+    case 0x1A:
+        if(n==0) P.tempReg=(b<<4)|(P.tempReg&0x00F);
+        if(n==1) P.tempReg=(P.tempReg&0xFF0)|(b>>4);
+        break;
+    case 0x22:
+        if(n==0) P.updateOption=b;
+        break;
+    case 0x24:
+    case 0x26:
+        sim_panel_ram_write(b);
+        break;
+    case 0x32:
+        if(n<153) P.lut[n]=b;
+        if(n==152) P.lutLoaded=1;
+        break;
+    case 0x46:
+        if(n==0) sim_panel_auto_write(P.red, b);
+        break;
+    case 0x47:
+        if(n==0) sim_panel_auto_write(P.bw, b);
+        break;
+    case 0x41:
+        if(n==0) P.readRed=b&0x01;
+        break;
+    case 0x37:
+        if(n==5) P.pingpong=(b&0x40)?1:0;
+        break;
+    case 0x44:
+        if(n==0) P.xStart=b&0x1F;
+        if(n==1) P.xEnd=b&0x1F;
+        break;
+    case 0x45:
+        if(n==1) P.yStart=(P.args[0]|(P.args[1]<<8))&0x1FF;
+        if(n==3) P.yEnd=(P.args[2]|(P.args[3]<<8))&0x1FF;
+        break;
+    case 0x4E:
+        if(n==0) P.x=b&0x1F;
+        break;
+    case 0x4F:
+        if(n==1) P.y=(P.args[0]|(P.args[1]<<8))&0x1FF;
+        break;
+    }
+}
+
+void sim_panel_spi(const uint8_t *data, int len, int dc) {
+    //a panel in deep sleep ignores everything till a hardware reset
+    if(P.sleeping) return;
+    for(int i=0; i<len; i++) {
+        if(!dc) sim_panel_command(data[i]);
+        else sim_panel_data(data[i]);
+    }
+}
+
+void sim_panel_read(uint8_t *data, int len) {
+    for(int i=0; i<len; i++) {
+        int n=P.argc++;
+        uint8_t b=0x00;
+        if(!P.sleeping) {
+            switch(P.cmd) {
+            case 0x1B:
+                if(n==0) b=P.tempReg>>4;
+                if(n==1) b=(P.tempReg<<4)&0xF0;
+                break;
+            case 0x27:
+                //the first byte is a dummy
+                if(n==0) break;
+                {
+                    const uint8_t *ram=P.readRed?P.red:P.bw;
+                    if(P.x>=0 && P.x<25 && P.y>=0 && P.y<200) b=ram[P.y*25+P.x];
+                }
+                sim_panel_advance();
+                break;
+            }
+        }
+        data[i]=b;
+    }
+}
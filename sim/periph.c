@@ -0,0 +1,477 @@
+/* periph.c
+ * GPIO, SPI master, SPI slave and UART stand-ins.
+ * Outputs are passed on to the models of the e-ink panel, the motor
+ * drivers and the charger module. Inputs are read from those models.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "driver/rtc_io.h"
+#include "driver/spi_master.h"
+#include "driver/spi_slave.h"
+#include "driver/uart.h"
+#include "sim.h"
+#include "model.h"
+
+static int levels[GPIO_NUM_MAX];
+static int outputs[GPIO_NUM_MAX];
+
+int sim_gpio_output(int pin) {
+    return outputs[pin]?levels[pin]:-1;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num) {
+    outputs[gpio_num]=0;
+    sim_spend(SIM_GPIO_US);
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode) {
+    outputs[gpio_num]=(mode&GPIO_MODE_OUTPUT)?1:0;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull) {
+    return ESP_OK;
+}
+
+void gpio_pad_select_gpio(uint8_t gpio_num) {
+}
+
+static uint32_t chargerWake=0;
+static int64_t chargerReady=0;
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level) {
+    level=level?1:0;
+    int changed=(levels[gpio_num]!=(int)level);
+    levels[gpio_num]=level;
+    //the panel keeps track of its own reset line, which is pulled
+    //up while the ESP sleeps
+    if(gpio_num==PIN_EINK_RST) sim_panel_rst(level);
+    if(!changed) return ESP_OK;
+    if(gpio_num==PIN_CHARGER_WAKE) {
+        //charger module wakes up and starts measuring
+        chargerWake=level;
+        chargerReady=sim_now()+SIM_CHARGER_REPLY_US;
+    }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num) {
+    switch(gpio_num) {
+    case PIN_EINK_BUSY:
+        return sim_panel_busy();
+    case PIN_SENSOR1:
+    case PIN_SENSOR2:
+    case PIN_SENSOR3:
+    case PIN_SENSOR4:
+        return sim_rings_sensor(gpio_num);
+    case PIN_CHARGER_MOSI:
+    case PIN_CHARGER_SCK:
+        return 1; //not charging
+    default:
+        //inputs have a pullup
+        return outputs[gpio_num]?levels[gpio_num]:1;
+    }
+}
+
+//GPIO interrupts. The input models tell when a level changes next,
+//so the scheduler can run the handler right on the edge
+
+static gpio_isr_t isrHandler[GPIO_NUM_MAX];
+static void *isrArg[GPIO_NUM_MAX];
+static int intrType[GPIO_NUM_MAX];
+static int intrEnabled[GPIO_NUM_MAX];
+static int isrLevel[GPIO_NUM_MAX];      //level the last edge check saw
+static int isrService=0;
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    intrType[gpio_num]=intr_type;
+    intrEnabled[gpio_num]=(intr_type!=GPIO_INTR_DISABLE);
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num) {
+    intrEnabled[gpio_num]=1;
+    isrLevel[gpio_num]=gpio_get_level(gpio_num);
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num) {
+    intrEnabled[gpio_num]=0;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags) {
+    if(isrService) return ESP_ERR_INVALID_STATE;
+    isrService=1;
+    sim_spend(SIM_ISR_INSTALL_US);
+    return ESP_OK;
+}
+
+void gpio_uninstall_isr_service(void) {
+    isrService=0;
+    memset(isrHandler, 0, sizeof(isrHandler));
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args) {
+    if(!isrService) return ESP_ERR_INVALID_STATE;
+    isrHandler[gpio_num]=isr_handler;
+    isrArg[gpio_num]=args;
+    isrLevel[gpio_num]=gpio_get_level(gpio_num);
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num) {
+    if(!isrService) return ESP_ERR_INVALID_STATE;
+    isrHandler[gpio_num]=NULL;
+    return ESP_OK;
+}
+
+static int sim_gpio_isr_armed(int pin) {
+    return isrHandler[pin] && intrEnabled[pin] && intrType[pin]!=GPIO_INTR_DISABLE;
+}
+
+//virtual time the level of an input changes next
+static int64_t sim_gpio_next_change(int pin) {
+    switch(pin) {
+    case PIN_EINK_BUSY:
+        return sim_panel_busy()?sim->panel.busyUntil:INT64_MAX;
+    case PIN_SENSOR1:
+    case PIN_SENSOR2:
+    case PIN_SENSOR3:
+    case PIN_SENSOR4:
+        return sim_rings_next_change(pin);
+    default:
+        return INT64_MAX;
+    }
+}
+
+int64_t sim_gpio_next_edge(void) {
+    int64_t next=INT64_MAX;
+    for(int pin=0; pin<GPIO_NUM_MAX; pin++) {
+        if(!sim_gpio_isr_armed(pin)) continue;
+        int64_t t=sim_gpio_next_change(pin);
+        if(t<next) next=t;
+    }
+    return next;
+}
+
+//run the handlers of the edges since the last check.
+//Returns the number of handlers that ran
+int sim_gpio_isr_run(void) {
+    int ran=0;
+    for(int pin=0; pin<GPIO_NUM_MAX; pin++) {
+        if(!sim_gpio_isr_armed(pin)) continue;
+        int level=gpio_get_level(pin);
+        if(level==isrLevel[pin]) continue;
+        isrLevel[pin]=level;
+        int type=intrType[pin];
+        if(type==GPIO_INTR_ANYEDGE || (type==GPIO_INTR_POSEDGE && level) ||
+           (type==GPIO_INTR_NEGEDGE && !level)) {
+            isrHandler[pin](isrArg[pin]);
+            sim->interrupts++;
+            ran++;
+        }
+    }
+    return ran;
+}
+
+//light sleep wake up on a GPIO level
+
+static int wakeupType[GPIO_NUM_MAX];
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    if(intr_type!=GPIO_INTR_LOW_LEVEL && intr_type!=GPIO_INTR_HIGH_LEVEL) return ESP_ERR_INVALID_ARG;
+    wakeupType[gpio_num]=intr_type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num) {
+    wakeupType[gpio_num]=GPIO_INTR_DISABLE;
+    return ESP_OK;
+}
+
+//virtual time a GPIO wakes the cpu from light sleep
+int64_t sim_gpio_wakeup_at(void) {
+    int64_t next=INT64_MAX;
+    for(int pin=0; pin<GPIO_NUM_MAX; pin++) {
+        if(wakeupType[pin]==GPIO_INTR_DISABLE) continue;
+        int64_t t=sim_now();
+        if(gpio_get_level(pin)!=(wakeupType[pin]==GPIO_INTR_HIGH_LEVEL)) t=sim_gpio_next_change(pin);
+        if(t<next) next=t;
+    }
+    return next;
+}
+
+esp_err_t rtc_gpio_init(gpio_num_t gpio_num) {
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_deinit(gpio_num_t gpio_num) {
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_set_direction(gpio_num_t gpio_num, rtc_gpio_mode_t mode) {
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_set_level(gpio_num_t gpio_num, uint32_t level) {
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_hold_en(gpio_num_t gpio_num) {
+    return ESP_OK;
+}
+
+esp_err_t rtc_gpio_hold_dis(gpio_num_t gpio_num) {
+    return ESP_OK;
+}
+
+//SPI master. Only the e-ink display is connected, but the firmware
+//may attach it more than once (at different clocks). Like the
+//driver, a device can't use the bus while another one acquired it
+
+#define SIM_SPI_DEVICES 3
+
+struct spi_device_t {
+    int used;
+    spi_device_interface_config_t cfg;
+    spi_transaction_t *queue[16];
+    int queued;
+    int acquired;           //bus acquired by spi_device_acquire_bus
+    int64_t busFree;        //end of the last queued transaction
+};
+
+static int busInitialized[3];
+static struct spi_device_t devices[SIM_SPI_DEVICES];
+static spi_device_handle_t busOwner;    //acquired the bus
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, int dma_chan) {
+    if(busInitialized[host]) return ESP_ERR_INVALID_STATE;
+    busInitialized[host]=1;
+    sim_spend(SIM_SPI_BUS_INIT_US);
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    if(!busInitialized[host]) return ESP_ERR_INVALID_STATE;
+    busInitialized[host]=0;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *dev_config, spi_device_handle_t *handle) {
+    if(!busInitialized[host]) return ESP_ERR_INVALID_STATE;
+    for(int i=0; i<SIM_SPI_DEVICES; i++) {
+        if(devices[i].used) continue;
+        memset(&devices[i], 0, sizeof(devices[i]));
+        devices[i].used=1;
+        devices[i].cfg=*dev_config;
+        *handle=&devices[i];
+        sim_spend(SIM_SPI_ADD_DEV_US);
+        return ESP_OK;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+    if(handle->queued || busOwner==handle) return ESP_ERR_INVALID_STATE;
+    handle->used=0;
+    return ESP_OK;
+}
+
+//the bus is acquired by another device. The driver would wait forever
+static int sim_spi_blocked(spi_device_handle_t handle) {
+    return busOwner!=NULL && busOwner!=handle;
+}
+
+//time the transaction occupies the bus
+static int64_t sim_spi_duration(spi_device_handle_t handle, spi_transaction_t *t) {
+    size_t bits=t->length+t->rxlength;
+    return (int64_t)bits*1000000/handle->cfg.clock_speed_hz;
+}
+
+//cpu time to set up a transaction
+static int64_t sim_spi_setup(spi_device_handle_t handle, spi_transaction_t *t) {
+    int64_t us=SIM_SPI_TRANS_US;
+    if(!handle->acquired) us+=SIM_SPI_LOCK_US;
+    if(!(t->flags&SPI_TRANS_USE_TXDATA) && t->length>0) us+=SIM_SPI_DMA_US;
+    return us;
+}
+
+//hand the bytes of a transaction to the panel
+static void sim_spi_deliver(spi_device_handle_t handle, spi_transaction_t *t) {
+    if(handle->cfg.pre_cb) handle->cfg.pre_cb(t);
+    const uint8_t *tx=(t->flags&SPI_TRANS_USE_TXDATA)?t->tx_data:t->tx_buffer;
+    int len=(t->length+7)/8;
+    //without a CS pin for the device the firmware drives CS itself
+    if(handle->cfg.spics_io_num<0 && levels[PIN_EINK_CS]!=0) {
+        fprintf(stderr, "SPI transaction while CS is high\n");
+        abort();
+    }
+    if(len>0) {
+        if(handle->cfg.clock_speed_hz>sim->panelMaxHz) {
+            //too fast for the wiring. The panel misses bits
+            uint8_t bad[len];
+            for(int i=0; i<len; i++) bad[i]=tx[i]^0x01;
+            sim_panel_spi(bad, len, levels[PIN_EINK_DC]);
+        } else sim_panel_spi(tx, len, levels[PIN_EINK_DC]);
+    }
+    //half duplex read after the write phase
+    int rxlen=(t->rxlength+7)/8;
+    if(rxlen>0) {
+        uint8_t *rx=(t->flags&SPI_TRANS_USE_RXDATA)?t->rx_data:t->rx_buffer;
+        sim_panel_read(rx, rxlen);
+        //the panel can't drive SDA that fast
+        if(handle->cfg.clock_speed_hz>SIM_PANEL_READ_MAX_HZ) memset(rx, 0xFF, rxlen);
+    }
+    //FNV-1a of the byte stream, regardless of how it is split
+    //into transactions
+    for(int i=0; i<len; i++) {
+        sim->spiHash^=(uint32_t)tx[i]|(levels[PIN_EINK_DC]<<8);
+        sim->spiHash*=16777619u;
+    }
+    sim->spiBytes+=len+rxlen;
+    sim->spiTransactions++;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc) {
+    //like the driver, no polling while queued transactions are pending
+    if(handle->queued || sim_spi_blocked(handle)) return ESP_ERR_INVALID_STATE;
+    //polling blocks the cpu till the transaction is done
+    if(handle->busFree>sim_now()) sim_spend(handle->busFree-sim_now());
+    sim_spend(sim_spi_setup(handle, trans_desc));
+    sim_spi_deliver(handle, trans_desc);
+    sim_spend(sim_spi_duration(handle, trans_desc));
+    if(handle->cfg.post_cb) handle->cfg.post_cb(trans_desc);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc) {
+    esp_err_t ret=spi_device_queue_trans(handle, trans_desc, portMAX_DELAY);
+    if(ret!=ESP_OK) return ret;
+    spi_transaction_t *done;
+    return spi_device_get_trans_result(handle, &done, portMAX_DELAY);
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans_desc, TickType_t ticks_to_wait) {
+    if(handle->queued>=handle->cfg.queue_size) return ESP_ERR_TIMEOUT;
+    if(sim_spi_blocked(handle)) return ESP_ERR_INVALID_STATE;
+    sim_spend(SIM_SPI_QUEUE_US);
+    //the transaction runs in the background. The panel receives
+    //the bytes in order so they can be delivered right away
+    int64_t start=handle->busFree>sim_now()?handle->busFree:sim_now();
+    sim_spi_deliver(handle, trans_desc);
+    handle->busFree=start+sim_spi_duration(handle, trans_desc);
+    handle->queue[handle->queued++]=trans_desc;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans_desc, TickType_t ticks_to_wait) {
+    if(handle->queued==0) return ESP_ERR_TIMEOUT;
+    //the task blocks till the bus is done with all queued transactions
+    if(handle->busFree>sim_now()) sim_task_delay(handle->busFree-sim_now());
+    *trans_desc=handle->queue[0];
+    handle->queued--;
+    memmove(handle->queue, handle->queue+1, handle->queued*sizeof(handle->queue[0]));
+    if(handle->cfg.post_cb) handle->cfg.post_cb(*trans_desc);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t device, TickType_t wait) {
+    if(sim_spi_blocked(device)) return ESP_ERR_INVALID_STATE;
+    device->acquired=1;
+    busOwner=device;
+    return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t dev) {
+    dev->acquired=0;
+    if(busOwner==dev) busOwner=NULL;
+}
+
+//SPI slave. Only the charger module is connected
+
+static const spi_slave_transaction_t *slaveQueue[4];
+static int slaveQueued=0;
+
+esp_err_t spi_slave_initialize(spi_host_device_t host, const spi_bus_config_t *bus_config, const spi_slave_interface_config_t *slave_config, int dma_chan) {
+    if(busInitialized[host]) return ESP_ERR_INVALID_STATE;
+    busInitialized[host]=1;
+    slaveQueued=0;
+    sim_spend(SIM_SPI_BUS_INIT_US);
+    return ESP_OK;
+}
+
+esp_err_t spi_slave_free(spi_host_device_t host) {
+    busInitialized[host]=0;
+    return ESP_OK;
+}
+
+esp_err_t spi_slave_queue_trans(spi_host_device_t host, const spi_slave_transaction_t *trans_desc, TickType_t ticks_to_wait) {
+    if(slaveQueued>=4) return ESP_ERR_TIMEOUT;
+    slaveQueue[slaveQueued++]=trans_desc;
+    return ESP_OK;
+}
+
+esp_err_t spi_slave_get_trans_result(spi_host_device_t host, spi_slave_transaction_t **trans_desc, TickType_t ticks_to_wait) {
+    int64_t timeout=(int64_t)ticks_to_wait*portTICK_PERIOD_MS*1000;
+    if(!chargerWake || slaveQueued==0 || chargerReady-sim_now()>timeout) {
+        //the charger module does not answer in time
+        sim_task_delay(timeout);
+        return ESP_ERR_TIMEOUT;
+    }
+    if(chargerReady>sim_now()) sim_task_delay(chargerReady-sim_now());
+    spi_slave_transaction_t *t=(spi_slave_transaction_t *)slaveQueue[0];
+    slaveQueued--;
+    memmove(slaveQueue, slaveQueue+1, slaveQueued*sizeof(slaveQueue[0]));
+    uint8_t *msg=t->rx_buffer;
+    memset(msg, 0, t->length/8);
+    msg[0]=0xA5;
+    msg[1]=0x08; //3 battery mode, not charging
+    msg[2]=SIM_BATTERY_V1/5;
+    msg[3]=SIM_BATTERY_V2/5;
+    msg[4]=SIM_BATTERY_V3/5;
+    t->trans_len=64;
+    *trans_desc=t;
+    return ESP_OK;
+}
+
+//UART. The motor drivers only listen
+
+static int uartInstalled[UART_NUM_MAX];
+
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size, int queue_size, QueueHandle_t *uart_queue, int intr_alloc_flags) {
+    if(uartInstalled[uart_num]) return ESP_FAIL;
+    uartInstalled[uart_num]=1;
+    sim_spend(SIM_UART_INSTALL_US);
+    return ESP_OK;
+}
+
+esp_err_t uart_driver_delete(uart_port_t uart_num) {
+    uartInstalled[uart_num]=0;
+    return ESP_OK;
+}
+
+esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t *uart_config) {
+    return ESP_OK;
+}
+
+esp_err_t uart_set_pin(uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num) {
+    return ESP_OK;
+}
+
+int uart_write_bytes(uart_port_t uart_num, const void *src, size_t size) {
+    const uint8_t *d=src;
+    if(!uartInstalled[uart_num]) return -1;
+    sim_spend(SIM_UART_WRITE_US);
+    //TMC2209 write datagram: sync, address, register, 4 data bytes, crc
+    if(size==8 && d[0]==0x05 && (d[2]&0x80)) {
+        int reg=d[2]&0x7F;
+        uint32_t val=((uint32_t)d[3]<<24)|((uint32_t)d[4]<<16)|((uint32_t)d[5]<<8)|d[6];
+        if(reg==0x22) sim_rings_vactual((uart_num==UART_NUM_1)?0:1, (int32_t)val);
+    }
+    return size;
+}
@@ -0,0 +1,139 @@
+/* rings.c
+ * Model of both rings, their stepper motors and position sensors.
+ * The hours ring carries 8 magnets on 12 positions forming the
+ * rotating code from README.md. The hourglass ring carries two
+ * magnets on opposite sides.
+ */
+#include <math.h>
+#include "sim.h"
+#include "model.h"
+
+#define R (sim->rings)
+
+//magnets on the hours ring. Index 0 is the 12 o'clock position,
+//each next index is the next hour position when rotating
+//counter clockwise: 12, 5, 10, 3, 8, 1, 6, 11, 4, 9, 2, 7
+static const int magnets[12] = { 1, 1, 0, 1, 1, 0, 0, 1, 0, 1, 1, 1 };
+
+//sensor positions relative to the current hour in slots
+//including a little misalignment of the sensors
+static double sensorOffset(int pin) {
+    switch(pin) {
+    case PIN_SENSOR3: return 1.01;
+    case PIN_SENSOR2: return 2.992;
+    case PIN_SENSOR1: return 4.005;
+    }
+    return 0;
+}
+
+//the tyre of the hours motor slips a little on the wood and more
+//where the ring is out of round. Part of the motor travel lost per
+//slot, index 0 is the slot counter clockwise from 12 o'clock
+static const double slip[12] = {
+    0.02, 0.03, 0.05, 0.08, 0.06, 0.03, 0.02, 0.02, 0.04, 0.07, 0.05, 0.03
+};
+
+static double hoursSlip(void) {
+    return slip[((int)floor(-R.hoursPos)%12+12)%12];
+}
+
+static int motorRunning(int motor) {
+    if(sim_gpio_output(PIN_VCC2_ENABLE)!=1) return 0;
+    if(sim_gpio_output(motor?PIN_MOTOR2_EN:PIN_MOTOR1_EN)!=0) return 0;
+    return R.vactual[motor]!=0;
+}
+
+void sim_rings_advance(int64_t from, int64_t to) {
+    double s=(double)(to-from)/1000000.0;
+    int running=0;
+    if(motorRunning(0)) {
+        //negative velocity turns counter clockwise
+        R.hoursPos-=(double)R.vactual[0]/SIM_HOURS_FULL_SPEED*(1.0-hoursSlip())
+                     *SIM_HOURS_MM_PER_S/SIM_HOURS_SLOT_MM*s;
+        running=1;
+    }
+    if(motorRunning(1)) {
+        R.hourglassPos+=(double)R.vactual[1]/SIM_HOURGLASS_SPEED/SIM_HOURGLASS_S*s;
+        running=1;
+    }
+    if(running) sim->motorUs+=to-from;
+}
+
+void sim_rings_vactual(int motor, int32_t value) {
+    //VACTUAL is a 24 bit signed value
+    value=(int32_t)((uint32_t)value<<8)>>8;
+    //the hours ring does not stop dead when its motor stops or
+    //reverses. It coasts on till friction has stopped it
+    int32_t old=R.vactual[motor];
+    if(motor==0 && motorRunning(0) && (value==0 || (value<0)!=(old<0))) {
+        double v=(double)old/SIM_HOURS_FULL_SPEED*(1.0-hoursSlip())*SIM_HOURS_MM_PER_S;
+        double coast=v*fabs(v)/(2.0*SIM_HOURS_COAST_MM_S2);
+        R.hoursPos-=coast/SIM_HOURS_SLOT_MM;
+    }
+    R.vactual[motor]=value;
+}
+
+int sim_rings_sensor(int pin) {
+    //sensors are low active
+    if(pin==PIN_SENSOR4) {
+        double d=R.hourglassPos-floor(R.hourglassPos+0.5);
+        return fabs(d)<SIM_HOURGLASS_WIDTH?0:1;
+    }
+    double p=R.hoursPos+sensorOffset(pin);
+    double slot=floor(p+0.5);
+    double d=(p-slot)*SIM_HOURS_SLOT_MM;
+    int i=((int)slot%12+12)%12;
+    if(magnets[i] && fabs(d)<SIM_MAGNET_RADIUS_MM) return 0;
+    return 1;
+}
+
+//time to travel from 'pos' to the nearest of the boundaries at
+//'center'+-'half' of slots that 'active' tells, moving 'speed' per µs
+static double timeToBoundary(double pos, double speed, double half, int (*active)(int)) {
+    double best=INFINITY;
+    for(int k=(int)floor(pos)-1; k<=(int)floor(pos)+2; k++) {
+        if(!active(k)) continue;
+        for(int side=-1; side<=1; side+=2) {
+            double t=(k+side*half-pos)/speed;
+            if(t>1e-9 && t<best) best=t;
+        }
+    }
+    return best;
+}
+
+static int hoursMagnet(int k) {
+    return magnets[(k%12+12)%12];
+}
+
+static int hourglassMagnet(int k) {
+    return 1;
+}
+
+//virtual time the level of a position sensor changes next, or at
+//least the time the speed of the ring changes (slip of the next slot)
+int64_t sim_rings_next_change(int pin) {
+    double t;
+    if(pin==PIN_SENSOR4) {
+        if(!motorRunning(1)) return INT64_MAX;
+        double speed=(double)R.vactual[1]/SIM_HOURGLASS_SPEED/SIM_HOURGLASS_S/1e6;
+        t=timeToBoundary(R.hourglassPos, speed, SIM_HOURGLASS_WIDTH, hourglassMagnet);
+    } else {
+        if(!motorRunning(0)) return INT64_MAX;
+        double speed=-(double)R.vactual[0]/SIM_HOURS_FULL_SPEED*(1.0-hoursSlip())
+                     *SIM_HOURS_MM_PER_S/SIM_HOURS_SLOT_MM/1e6;
+        t=timeToBoundary(R.hoursPos+sensorOffset(pin), speed,
+                         SIM_MAGNET_RADIUS_MM/SIM_HOURS_SLOT_MM, hoursMagnet);
+        double slot=(speed>0?ceil(R.hoursPos):floor(R.hoursPos))-R.hoursPos;
+        if(slot/speed>1e-9 && slot/speed<t) t=slot/speed;
+    }
+    if(t>1e15) return INT64_MAX;
+    return sim_now()+(int64_t)ceil(t);
+}
+
+//hour shown by the hours ring at the 12 o'clock mark
+int sim_rings_hour(void) {
+    R.landingMm=(R.hoursPos-floor(R.hoursPos+0.5))*SIM_HOURS_SLOT_MM;
+    int i=((int)floor(R.hoursPos+0.5)%12+12)%12;
+    int h=(5*i)%12;
+    return h?h:12;
+}
@@ -0,0 +1,379 @@
+/* sched.c
+ * Virtual clock, cooperative FreeRTOS task stand-in and esp_timer.
+ * Tasks only switch when they block (vTaskDelay and friends). While
+ * time passes, the esp_timer callbacks and GPIO interrupts fire on
+ * time and the current drawn by the ESP is integrated.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include "sim.h"
+#include "model.h"
+
+#define SIM_MAX_TASKS   8
+#define SIM_STACK_SIZE  (256*1024)
+
+#define TASK_FREE       0
+#define TASK_READY      1
+#define TASK_SUSPENDED  2
+#define TASK_DEAD       3
+
+struct sim_semaphore {
+    int        count;
+    int        max;
+};
+
+struct sim_event_group {
+    EventBits_t bits;
+};
+
+struct sim_task {
+    ucontext_t ctx;
+    int64_t    wake;
+    struct sim_semaphore *waitSem;  //blocked in xSemaphoreTake
+    struct sim_event_group *waitGroup; //blocked in xEventGroupWaitBits
+    EventBits_t waitBits;
+    int        waitAll;
+    int        state;
+    TaskFunction_t fn;
+    void      *arg;
+    void      *stack;
+};
+
+struct esp_timer {
+    esp_timer_cb_t cb;
+    void      *arg;
+    int64_t    next;
+    int64_t    period;
+    int        active;
+    struct esp_timer *link;
+};
+
+static struct sim_task tasks[SIM_MAX_TASKS];
+static int current=0;
+static struct esp_timer *timers=NULL;
+static double loads[SIM_LOAD_COUNT];
+static int64_t wakeStart=0;
+
+int64_t sim_now(void) {
+    return sim->now;
+}
+
+int64_t sim_wake_start(void) {
+    return wakeStart;
+}
+
+void sim_set_load(int load, double mA) {
+    loads[load]=mA;
+}
+
+//advance the virtual clock without firing timers
+static void sim_advance(int64_t to) {
+    if(to<=sim->now) return;
+    double mA=0;
+    for(int i=0; i<SIM_LOAD_COUNT; i++) mA+=loads[i];
+    sim->activeUAs+=mA*(double)(to-sim->now)/1000.0;
+    sim_rings_advance(sim->now, to);
+    sim->now=to;
+    if(sim->now-wakeStart>SIM_WAKE_LIMIT_US) {
+        fprintf(stderr, "wake takes longer than %d sec\n", SIM_WAKE_LIMIT_US/1000000);
+        abort();
+    }
+}
+
+//time of the next timer or GPIO interrupt
+int64_t sim_timers_next(void) {
+    int64_t next=sim_gpio_next_edge();
+    for(struct esp_timer *t=timers; t; t=t->link) {
+        if(t->active && t->next<next) next=t->next;
+    }
+    return next;
+}
+
+//run the GPIO interrupt handlers of edges up to now
+static void sim_isr_run(void) {
+    int ran;
+    while((ran=sim_gpio_isr_run())>0) sim_advance(sim->now+ran*SIM_ISR_US);
+}
+
+//fire all timers and interrupts that happen up to and including 'until'
+void sim_timers_run(int64_t until) {
+    int64_t next;
+    sim_isr_run();  //edges caused by what the task just did
+    while((next=sim_timers_next())<=until) {
+        sim_advance(next);
+        sim_isr_run();
+        for(struct esp_timer *t=timers; t; t=t->link) {
+            if(t->active && t->next<=sim->now) {
+                if(t->period) t->next+=t->period;
+                else t->active=0;
+                sim->timerCallbacks++;
+                t->cb(t->arg);
+                sim_advance(sim->now+SIM_TIMER_CB_US);
+                break;
+            }
+        }
+    }
+    sim_advance(until);
+}
+
+//light sleep till 'until'. Timers and interrupts that are due
+//run when the cpu is awake again
+void sim_light_sleep(int64_t until) {
+    double mA=loads[SIM_LOAD_CPU];
+    loads[SIM_LOAD_CPU]=SIM_LIGHT_SLEEP_MA;
+    if(until>sim->now) sim->lightSleepUs+=until-sim->now;
+    sim_advance(until);
+    loads[SIM_LOAD_CPU]=mA;
+}
+
+void sim_spend(int64_t us) {
+    sim_timers_run(sim->now+us);
+}
+
+void sim_sched_init(void) {
+    memset(tasks, 0, sizeof(tasks));
+    tasks[0].state=TASK_READY;
+    current=0;
+    timers=NULL;
+    memset(loads, 0, sizeof(loads));
+    wakeStart=sim->now;
+}
+
+//switch to the ready task that wakes up first
+static void sim_schedule(void) {
+    while(1) {
+        int next=-1;
+        for(int i=0; i<SIM_MAX_TASKS; i++) {
+            if(tasks[i].state!=TASK_READY) continue;
+            if(next<0 || tasks[i].wake<tasks[next].wake) next=i;
+        }
+        if(next<0) {
+            fprintf(stderr, "all tasks are blocked\n");
+            abort();
+        }
+        if(tasks[next].wake>sim->now) {
+            //nothing to run. Let time pass till the first
+            //timer or task and look again
+            int64_t t=sim_timers_next();
+            if(t>tasks[next].wake) t=tasks[next].wake;
+            sim_timers_run(t);
+            continue;
+        }
+        if(next!=current) {
+            int prev=current;
+            current=next;
+            swapcontext(&tasks[prev].ctx, &tasks[next].ctx);
+        }
+        return;
+    }
+}
+
+void sim_task_delay(int64_t us) {
+    tasks[current].wake=sim->now+us;
+    sim_schedule();
+}
+
+static void sim_task_entry(void) {
+    tasks[current].fn(tasks[current].arg);
+    tasks[current].state=TASK_DEAD;
+    sim_schedule();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char *pcName,
+                       uint32_t usStackDepth, void *pvParameters,
+                       UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask) {
+    int i;
+    for(i=0; i<SIM_MAX_TASKS; i++) {
+        if(tasks[i].state==TASK_FREE) break;
+    }
+    if(i==SIM_MAX_TASKS) return pdFAIL;
+    struct sim_task *t=&tasks[i];
+    t->fn=pvTaskCode;
+    t->arg=pvParameters;
+    t->stack=malloc(SIM_STACK_SIZE);
+    getcontext(&t->ctx);
+    t->ctx.uc_stack.ss_sp=t->stack;
+    t->ctx.uc_stack.ss_size=SIM_STACK_SIZE;
+    t->ctx.uc_link=NULL;
+    makecontext(&t->ctx, sim_task_entry, 0);
+    t->wake=sim->now;
+    t->state=TASK_READY;
+    if(pvCreatedTask) *pvCreatedTask=(TaskHandle_t)t;
+    return pdPASS;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay) {
+    sim_task_delay((int64_t)xTicksToDelay*portTICK_PERIOD_MS*1000);
+}
+
+void vTaskSuspend(TaskHandle_t xTaskToSuspend) {
+    struct sim_task *t=xTaskToSuspend?(struct sim_task *)xTaskToSuspend:&tasks[current];
+    t->state=TASK_SUSPENDED;
+    if(t==&tasks[current]) sim_schedule();
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete) {
+    struct sim_task *t=xTaskToDelete?(struct sim_task *)xTaskToDelete:&tasks[current];
+    t->state=TASK_DEAD;
+    if(t==&tasks[current]) sim_schedule();
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    struct sim_semaphore *sem=calloc(1, sizeof(struct sim_semaphore));
+    sem->max=1;
+    return sem;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore) {
+    free(xSemaphore);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xTicksToWait) {
+    if(xSemaphore->count==0 && xTicksToWait>0) {
+        //block till given or timed out
+        struct sim_task *t=&tasks[current];
+        t->waitSem=xSemaphore;
+        t->wake=(xTicksToWait==portMAX_DELAY)?INT64_MAX:
+                sim->now+(int64_t)xTicksToWait*portTICK_PERIOD_MS*1000;
+        sim_schedule();
+        t->waitSem=NULL;
+    }
+    if(xSemaphore->count==0) return pdFALSE;
+    xSemaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore) {
+    if(xSemaphore->count>=xSemaphore->max) return pdFALSE;
+    xSemaphore->count++;
+    //wake the first task waiting for it
+    for(int i=0; i<SIM_MAX_TASKS; i++) {
+        if(tasks[i].state==TASK_READY && tasks[i].waitSem==xSemaphore) {
+            tasks[i].waitSem=NULL;
+            tasks[i].wake=sim->now;
+            break;
+        }
+    }
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken) {
+    BaseType_t ret=xSemaphoreGive(xSemaphore);
+    if(pxHigherPriorityTaskWoken) *pxHigherPriorityTaskWoken=pdTRUE;
+    return ret;
+}
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    return calloc(1, sizeof(struct sim_event_group));
+}
+
+void vEventGroupDelete(EventGroupHandle_t xEventGroup) {
+    free(xEventGroup);
+}
+
+static int sim_bits_set(EventBits_t bits, EventBits_t wait, int all) {
+    return all?(bits&wait)==wait:(bits&wait)!=0;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet) {
+    xEventGroup->bits|=uxBitsToSet;
+    //wake the tasks waiting for these bits
+    for(int i=0; i<SIM_MAX_TASKS; i++) {
+        struct sim_task *t=&tasks[i];
+        if(t->state==TASK_READY && t->waitGroup==xEventGroup &&
+           sim_bits_set(xEventGroup->bits, t->waitBits, t->waitAll)) {
+            t->waitGroup=NULL;
+            t->wake=sim->now;
+        }
+    }
+    return xEventGroup->bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear) {
+    EventBits_t bits=xEventGroup->bits;
+    xEventGroup->bits&=~uxBitsToClear;
+    return bits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToWaitFor,
+                                const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits,
+                                TickType_t xTicksToWait) {
+    if(!sim_bits_set(xEventGroup->bits, uxBitsToWaitFor, xWaitForAllBits) && xTicksToWait>0) {
+        //block till set or timed out
+        struct sim_task *t=&tasks[current];
+        t->waitGroup=xEventGroup;
+        t->waitBits=uxBitsToWaitFor;
+        t->waitAll=xWaitForAllBits;
+        t->wake=(xTicksToWait==portMAX_DELAY)?INT64_MAX:
+                sim->now+(int64_t)xTicksToWait*portTICK_PERIOD_MS*1000;
+        sim_schedule();
+        t->waitGroup=NULL;
+    }
+    EventBits_t bits=xEventGroup->bits;
+    if(xClearOnExit && sim_bits_set(bits, uxBitsToWaitFor, xWaitForAllBits)) {
+        xEventGroup->bits&=~uxBitsToWaitFor;
+    }
+    return bits;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)((sim->now-wakeStart)/(portTICK_PERIOD_MS*1000));
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle) {
+    struct esp_timer *t=calloc(1, sizeof(struct esp_timer));
+    t->cb=args->callback;
+    t->arg=args->arg;
+    t->link=timers;
+    timers=t;
+    *out_handle=t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if(timer->active) return ESP_ERR_INVALID_STATE;
+    timer->next=sim->now+timeout_us;
+    timer->period=0;
+    timer->active=1;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    if(timer->active) return ESP_ERR_INVALID_STATE;
+    timer->next=sim->now+period;
+    timer->period=period;
+    timer->active=1;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if(!timer->active) return ESP_ERR_INVALID_STATE;
+    timer->active=0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if(timer->active) return ESP_ERR_INVALID_STATE;
+    struct esp_timer **p=&timers;
+    while(*p && *p!=timer) p=&(*p)->link;
+    if(*p) *p=timer->link;
+    free(timer);
+    return ESP_OK;
+}
+
+void esp_rom_delay_us(uint32_t us) {
+    //busy wait, the cpu keeps running
+    sim_spend(us);
+}
+
+int64_t esp_timer_get_time(void) {
+    return sim->now-wakeStart;
+}
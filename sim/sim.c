@@ -0,0 +1,452 @@
+/* sim.c
+ * Host simulation of the hourglass clock.
+ * Runs app_main for every wake from deep sleep on a virtual clock,
+ * days or months of wakes in seconds, and reports the active time
+ * and the estimated charge drawn from the ESP battery per cycle type.
+ *
+ * Every wake runs in a child process. The RTC memory sections are
+ * copied in when the child starts and copied out when it enters deep
+ * sleep, so only RTC variables survive deep sleep, like on the ESP32.
+ * After a panic or a software reset only the RTC_NOINIT_ATTR variables
+ * keep their value.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "esp_system.h"
+#include "esp_sleep.h"
+#include "sim.h"
+#include "model.h"
+#include "profile.h"
+#include "eink.h"
+#include "storage.h"
+
+void app_main(void);
+
+sim_world_t *sim;
+int sim_verbose=0;
+
+//RTC memory sections, see esp_attr.h
+extern char __start_rtc_data[] __attribute__((weak));
+extern char __stop_rtc_data[] __attribute__((weak));
+extern char __start_rtc_noinit[] __attribute__((weak));
+extern char __stop_rtc_noinit[] __attribute__((weak));
+static char *rtcData;
+static char *rtcNoinit;
+
+#define RTC_DATA_SIZE   ((size_t)(__stop_rtc_data-__start_rtc_data))
+#define RTC_NOINIT_SIZE ((size_t)(__stop_rtc_noinit-__start_rtc_noinit))
+
+static const char *cycleNames[SIM_CYCLE_TYPES] = {
+    "idle", "partial", "full", "rotation", "sync"
+};
+
+typedef struct {
+    int     count;
+    int64_t activeMin;
+    int64_t activeMax;
+    double  activeSum;
+    double  uAs;
+    double  spiBytes;
+} sim_cycle_stats_t;
+
+static sim_cycle_stats_t stats[SIM_CYCLE_TYPES];
+
+void sim_note_cycle(int cycle) {
+    if(cycle>sim->cycle) sim->cycle=cycle;
+}
+
+void sim_rtc_save(void) {
+    memcpy(rtcData, __start_rtc_data, RTC_DATA_SIZE);
+    memcpy(rtcNoinit, __start_rtc_noinit, RTC_NOINIT_SIZE);
+}
+
+void sim_wake_end(int64_t sleepUs) {
+    sim->activeUs=sim_now()-sim_wake_start();
+    sim->sleepUs=sleepUs;
+    sim->rotated=sim_rings_hour();
+    sim_rtc_save();
+    fflush(stdout);
+    _exit(0);
+}
+
+static void sim_crash(int sig) {
+    //only the RTC_NOINIT_ATTR variables survive a panic
+    memcpy(rtcNoinit, __start_rtc_noinit, RTC_NOINIT_SIZE);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+static void sim_child(void) {
+    if(!sim_verbose) {
+        if(!freopen("/dev/null", "w", stdout)) exit(3);
+    }
+    //the RTC_DATA_ATTR variables are initialized again after any
+    //other reset than a wake from deep sleep
+    if(sim->resetReason==ESP_RST_DEEPSLEEP) memcpy(__start_rtc_data, rtcData, RTC_DATA_SIZE);
+    memcpy(__start_rtc_noinit, rtcNoinit, RTC_NOINIT_SIZE);
+    signal(SIGABRT, sim_crash);
+    signal(SIGSEGV, sim_crash);
+    srandom(sim->wakes);
+    sim_sched_init();
+    sim_set_load(SIM_LOAD_CPU, SIM_CPU_MA);
+    sim_spend(SIM_BOOT_US);
+    app_main();
+    fprintf(stderr, "app_main returned\n");
+    exit(2);
+}
+
+static void *sim_shared(size_t size) {
+    void *p=mmap(NULL, size?size:1, PROT_READ|PROT_WRITE,
+                 MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if(p==MAP_FAILED) {
+        perror("mmap");
+        exit(1);
+    }
+    return p;
+}
+
+//hour the firmware should set the rings to, from the RTC time
+static int sim_expected_hour(void) {
+    time_t now=(time_t)((sim->now+sim->rtcOffset)/1000000);
+    struct tm tm;
+    localtime_r(&now, &tm);
+    int hour=tm.tm_hour;
+    if(tm.tm_min==59) hour++;
+    hour%=12;
+    return hour?hour:12;
+}
+
+//runs one wake of the firmware till it enters deep sleep, in a child
+//process. Returns 1 if it crashed
+static int sim_wake(void) {
+    sim->cycle=SIM_CYCLE_IDLE;
+    sim->activeUs=0;
+    sim->activeUAs=0;
+    sim->panelUAs=0;
+    sim->panelBusyUs=0;
+    sim->motorUs=0;
+    sim->lightSleepUs=0;
+    sim->spiBytes=0;
+    sim->spiTransactions=0;
+    sim->spiHash=2166136261u;
+    sim->timerCallbacks=0;
+    sim->interrupts=0;
+    sim->updates=0;
+    int64_t wakeStart=sim->now;
+    int crashed=0;
+    fflush(stdout);
+    pid_t pid=fork();
+    if(pid<0) {
+        perror("fork");
+        exit(1);
+    }
+    if(pid==0) sim_child();
+    int status;
+    waitpid(pid, &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status)!=0) {
+        //panic. The ESP reboots right away
+        crashed=1;
+        sim->activeUs=sim->now-wakeStart;
+        sim->sleepUs=0;
+        sim->resetReason=ESP_RST_PANIC;
+        sim->wakeupCause=ESP_SLEEP_WAKEUP_UNDEFINED;
+    } else if(sim->resetReason==ESP_RST_SW) {
+        sim->wakeupCause=ESP_SLEEP_WAKEUP_UNDEFINED;
+    } else {
+        sim->resetReason=ESP_RST_DEEPSLEEP;
+        sim->wakeupCause=ESP_SLEEP_WAKEUP_TIMER;
+    }
+    sim->wakes++;
+    return crashed;
+}
+
+//the clock is powered on at 'epoch' with empty RTC memory and the
+//hours ring 'hoursPos' slots counter clockwise from 12 o'clock
+static void sim_power_on(int64_t epoch, double hoursPos) {
+    memcpy(rtcData, __start_rtc_data, RTC_DATA_SIZE);
+    memset(rtcNoinit, 0, RTC_NOINIT_SIZE);
+    memset(sim->nvs, 0, sizeof(sim->nvs));
+    memset(&sim->panel, 0, sizeof(sim->panel));
+    memset(&sim->rings, 0, sizeof(sim->rings));
+    sim->now=0;
+    sim->rtcOffset=0;
+    sim->epoch=epoch;
+    sim->resetReason=ESP_RST_POWERON;
+    sim->wakeupCause=ESP_SLEEP_WAKEUP_UNDEFINED;
+    memset(sim->panel.screen, 0xFF, SIM_PANEL_RAM);
+    sim->panel.rstLevel=1;
+    sim->rings.hoursPos=hoursPos;
+}
+
+//setup mode, run once when the clock was installed. Only the part the
+//wakes depend on: the SPI clock of the display it keeps in NVS, see
+//setup.c. It takes no time on the virtual clock
+static void sim_setup(void) {
+    int64_t now=sim->now;
+    fflush(stdout);
+    pid_t pid=fork();
+    if(pid<0) {
+        perror("fork");
+        exit(1);
+    }
+    if(pid==0) {
+        if(!sim_verbose) {
+            if(!freopen("/dev/null", "w", stdout)) exit(3);
+        }
+        sim_sched_init();
+        eink_start();
+        storage_set_u32(STORAGE_EINK_SPI_CLOCK, eink_calibrate_spi());
+        eink_stop();
+        fflush(stdout);
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    sim->now=now;
+}
+
+//the hourglass flipped exactly once and stopped on its magnet
+static int sim_hourglass_flipped(double hourglassStart) {
+    double hourglass=sim->rings.hourglassPos;
+    return floor(hourglass+0.5)-floor(hourglassStart+0.5)==1 &&
+           fabs(hourglass-floor(hourglass+0.5))<=SIM_HOURGLASS_WIDTH;
+}
+
+//unix time of 'hour' o'clock local time, 'days' after 'date'
+static int64_t sim_local_time(const struct tm *date, int days, int hour) {
+    struct tm tm={ .tm_year=date->tm_year, .tm_mon=date->tm_mon,
+                   .tm_mday=date->tm_mday+days, .tm_hour=hour, .tm_isdst=-1 };
+    return mktime(&tm);
+}
+
+//wakes on the hour and checks the rings end up at the hour.
+//Returns 1 if they didn't
+static int sim_check_rotation(const char *from) {
+    double hourglassStart=sim->rings.hourglassPos;
+    int crashed=sim_wake();
+    int check=sim_expected_hour();
+    if(!crashed && sim->rotated==check && sim_hourglass_flipped(hourglassStart)) return 0;
+    printf("%s to %d: %s, hours ring at %d, hourglass %.2f half turns\n", from, check,
+           crashed?"crashed":"off target", sim->rotated, sim->rings.hourglassPos-hourglassStart);
+    return 1;
+}
+
+//every start position of the hours ring, on and between the
+//positions, to every hour after power on. Then every hour the rings
+//were set to before, to every hour on the next wake on the hour. That
+//includes the daylight saving time changes: 1 to 3 o'clock in spring
+//and 2 to 2 o'clock in autumn
+static int sim_check_rotations(const struct tm *date) {
+    static const double offsets[]={ 0, 0.5 };
+    int cases=0, misses=0;
+    char from[64];
+    for(int slot=0; slot<12; slot++) {
+        for(int o=0; o<2; o++) {
+            for(int hour=1; hour<=12; hour++) {
+                sim_power_on(sim_local_time(date, 0, hour), slot+offsets[o]);
+                snprintf(from, sizeof(from), "Power on at slot %.1f", slot+offsets[o]);
+                misses+=sim_check_rotation(from);
+                cases++;
+            }
+        }
+    }
+    for(int before=1; before<=12; before++) {
+        for(int hour=1; hour<=12; hour++) {
+            sim_power_on(sim_local_time(date, 0, before), 0);
+            snprintf(from, sizeof(from), "Power on to %d", before);
+            if(sim_check_rotation(from)) {
+                misses++;
+                continue;
+            }
+            //deep sleep till the hour the next day
+            sim->now=(sim_local_time(date, 1, hour)-sim->epoch)*1000000;
+            snprintf(from, sizeof(from), "From %d", before);
+            misses+=sim_check_rotation(from);
+            cases++;
+        }
+    }
+    printf("Rotations checked %d, rings off target %d\n", cases, misses);
+    return misses?1:0;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+        "usage: %s [-d days] [-s YYYY-MM-DD] [-r ppm] [-c mAh] [-T celsius] [-S hz] [-H hash] [-R] [-p] [-t] [-v]\n"
+        "  -d  number of days to simulate (default 1)\n"
+        "  -s  date the clock is powered on, midnight UTC (default 2021-10-01)\n"
+        "  -r  drift of the RTC in ppm (default 20)\n"
+        "  -c  capacity of the ESP battery in mAh (default 2500)\n"
+        "  -T  temperature around the clock in degrees C (default 21)\n"
+        "  -S  fastest SPI clock the panel takes reliably (default 20000000)\n"
+        "  -H  exit with an error if the hash of everything sent to the panel\n"
+        "      differs from this one, see make check\n"
+        "  -R  check the rotation from every position of the rings to every hour\n"
+        "      on the date of -s and the day after, instead of simulating days\n"
+        "  -p  print the profile kept by the firmware (as /info.json)\n"
+        "  -t  print a line for every wake\n"
+        "  -v  print the firmware log\n", name);
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    double days=1;
+    double drift=20;
+    double capacity=2500;
+    double temperature=21;
+    int panelMaxHz=20000000;
+    int trace=0;
+    int profile=0;
+    int rotations=0;  //-R: check the rotations instead
+    int checkStream=0;
+    uint32_t expectStream=0;
+    struct tm start={ .tm_year=2021-1900, .tm_mon=9, .tm_mday=1 };
+    int opt;
+    while((opt=getopt(argc, argv, "d:s:r:c:T:S:H:Rptv"))!=-1) {
+        switch(opt) {
+        case 'd': days=atof(optarg); break;
+        case 's':
+            if(sscanf(optarg, "%d-%d-%d", &start.tm_year, &start.tm_mon, &start.tm_mday)!=3) usage(argv[0]);
+            start.tm_year-=1900;
+            start.tm_mon-=1;
+            break;
+        case 'r': drift=atof(optarg); break;
+        case 'c': capacity=atof(optarg); break;
+        case 'T': temperature=atof(optarg); break;
+        case 'S': panelMaxHz=atoi(optarg); break;
+        case 'H':
+            if(sscanf(optarg, "%x", &expectStream)!=1) usage(argv[0]);
+            checkStream=1;
+            break;
+        case 'R': rotations=1; break;
+        case 'p': profile=1; break;
+        case 't': trace=1; break;
+        case 'v': sim_verbose=1; break;
+        default: usage(argv[0]);
+        }
+    }
+    //same time zone as the firmware
+    setenv("TZ", "CET-1CEST-2,M3.5.0/2,M10.5.0/3", 1);
+    tzset();
+
+    sim=sim_shared(sizeof(sim_world_t));
+    rtcData=sim_shared(RTC_DATA_SIZE);
+    rtcNoinit=sim_shared(RTC_NOINIT_SIZE);
+    sim->temperature=temperature;
+    sim->panelMaxHz=panelMaxHz;
+    if(rotations) return sim_check_rotations(&start);
+    sim_power_on(timegm(&start), 3);  //hours ring at 3 o'clock
+    sim_setup();
+
+    int64_t end=(int64_t)(days*86400e6);
+    int crashes=0, misses=0;
+    rotations=0;
+    double landingSum=0, landingMax=0, rotationWakeups=0;
+    double sleepUAs=0, motorUs=0, panelBusyUs=0, lightSleepUs=0, totalUAs=0;
+    int staleRed=0;
+    uint32_t streamHash=2166136261u;  //of the streams of all wakes
+    while(sim->now<end) {
+        double hourglassStart=sim->rings.hourglassPos;
+        int64_t trueTime=sim->epoch+sim->now/1000000;
+        crashes+=sim_wake();
+
+        int check=-1;
+        if(sim->motorUs>0) {
+            sim_note_cycle(SIM_CYCLE_ROTATE);
+            rotations++;
+            check=sim_expected_hour();
+            if(check!=sim->rotated) misses++;
+            if(!sim_hourglass_flipped(hourglassStart)) misses++;
+            double landing=fabs(sim->rings.landingMm);
+            landingSum+=landing;
+            if(landing>landingMax) landingMax=landing;
+            rotationWakeups+=sim->timerCallbacks+sim->interrupts;
+        }
+        staleRed=sim->panel.staleRed;
+        double uAs=sim->activeUAs+sim->panelUAs;
+        sim_cycle_stats_t *s=&stats[sim->cycle];
+        if(s->count==0 || sim->activeUs<s->activeMin) s->activeMin=sim->activeUs;
+        if(sim->activeUs>s->activeMax) s->activeMax=sim->activeUs;
+        s->count++;
+        s->activeSum+=sim->activeUs;
+        s->uAs+=uAs;
+        s->spiBytes+=sim->spiBytes;
+        motorUs+=sim->motorUs;
+        panelBusyUs+=sim->panelBusyUs;
+        lightSleepUs+=sim->lightSleepUs;
+        sleepUAs+=SIM_DEEP_SLEEP_UA*(double)sim->sleepUs/1000000.0;
+        //a display that is not in deep sleep draws more
+        if(!sim->panel.sleeping) sleepUAs+=SIM_PANEL_IDLE_UA*(double)sim->sleepUs/1000000.0;
+        totalUAs+=uAs;
+        for(int i=0; i<4; i++) {
+            streamHash^=(sim->spiHash>>(8*i))&0xFF;
+            streamHash*=16777619u;
+        }
+
+        if(trace) {
+            struct tm tm;
+            gmtime_r(&trueTime, &tm);
+            printf("%04d-%02d-%02d %02d:%02d:%02d %-8s %8.1f ms %7.2f uAh spi %5d B/%3d tr",
+                tm.tm_year+1900, tm.tm_mon+1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+                cycleNames[sim->cycle], sim->activeUs/1000.0, uAs/3600.0,
+                sim->spiBytes, sim->spiTransactions);
+            if(sim->spiBytes) printf(" stream %08x", sim->spiHash);
+            if(sim->updates) printf(" screen %08x", sim->screenHash);
+            if(check>=0) printf(" ring %d/%d", sim->rotated, check);
+            printf("\n");
+        }
+
+        //deep sleep. The sleep timer runs on the same (drifting)
+        //clock as the RTC so the RTC advances exactly sleepUs
+        int64_t driftUs=(int64_t)((double)sim->sleepUs*drift/1000000.0);
+        sim->now+=sim->sleepUs-driftUs;
+        sim->rtcOffset+=driftUs;
+    }
+
+    double simDays=(double)sim->now/86400e6;
+    printf("Simulated %.2f days, %d wakes, %d crashes\n", simDays, sim->wakes, crashes);
+    printf("RTC memory used: %zu bytes\n", RTC_DATA_SIZE+RTC_NOINIT_SIZE);
+    printf("%-9s %7s %28s %10s %10s %9s\n", "cycle", "count", "active ms (min/avg/max)",
+           "uAh/cycle", "uAh/day", "SPI B");
+    for(int i=0; i<SIM_CYCLE_TYPES; i++) {
+        sim_cycle_stats_t *s=&stats[i];
+        if(s->count==0) continue;
+        printf("%-9s %7d %9.1f/%8.1f/%9.1f %10.2f %10.1f %9.0f\n", cycleNames[i], s->count,
+               s->activeMin/1000.0, s->activeSum/s->count/1000.0, s->activeMax/1000.0,
+               s->uAs/s->count/3600.0, s->uAs/3600.0/simDays, s->spiBytes/s->count);
+    }
+    printf("%-9s %7s %28s %10s %10.1f\n", "sleep", "", "", "", sleepUAs/3600.0/simDays);
+    double perDay=(totalUAs+sleepUAs)/3600.0/simDays;
+    printf("Total %.2f mAh/day, average %.1f uA, %.0f days on %.0f mAh\n",
+           perDay/1000.0, perDay/24.0, capacity*1000.0/perDay, capacity);
+    printf("Panel busy %.1f s/day, motors %.1f s/day, light sleep %.1f s/day\n",
+           panelBusyUs/1e6/simDays, motorUs/1e6/simDays, lightSleepUs/1e6/simDays);
+    printf("Display updates %.1f partial, %.1f regional and %.1f full per day\n",
+           sim->panel.partialUpdates/simDays, sim->panel.regionalUpdates/simDays,
+           sim->panel.fullUpdates/simDays);
+    printf("Rotations %d, rings off target %d, partial updates on stale red ram %d\n",
+           rotations, misses, staleRed);
+    if(rotations) printf("Hours ring stopped %.1f mm (max %.1f mm) from the center of the magnets\n",
+                         landingSum/rotations, landingMax);
+    if(rotations) printf("Timer callbacks and interrupts %.0f per rotation\n", rotationWakeups/rotations);
+    printf("Panel stream hash %08x\n", streamHash);
+    if(profile) {
+        //RTC memory as left by the last wake
+        static char json[8192];
+        memcpy(__start_rtc_data, rtcData, RTC_DATA_SIZE);
+        profile_json(json, sizeof(json));
+        printf("%s\n", json);
+    }
+    if(checkStream && streamHash!=expectStream) {
+        printf("Panel stream differs from %08x\n", expectStream);
+        return 1;
+    }
+    return 0;
+}
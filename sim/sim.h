@@ -0,0 +1,141 @@
+/* sim.h
+ * Internal interface of the host simulation.
+ * The simulation runs the clock firmware on a virtual clock.
+ * Every wake from deep sleep runs in a forked child process so
+ * ordinary DRAM starts fresh, just like on the ESP32. Everything
+ * that survives deep sleep (RTC memory, the panel, the rings and
+ * the time itself) lives in the shared world structure.
+ */
+#ifndef _SIM_H
+#define _SIM_H
+
+#include <stdint.h>
+
+//cycle types. A wake is classified by the most expensive
+//thing it did.
+#define SIM_CYCLE_IDLE      0   //no display update at all
+#define SIM_CYCLE_PARTIAL   1
+#define SIM_CYCLE_FULL      2
+#define SIM_CYCLE_ROTATE    3
+#define SIM_CYCLE_SYNC      4
+#define SIM_CYCLE_TYPES     5
+
+//current consumers that are integrated over time
+#define SIM_LOAD_CPU   0
+#define SIM_LOAD_WIFI  1
+#define SIM_LOAD_COUNT 2
+
+//values kept in the simulated NVS
+#define SIM_NVS_KEYS 8
+
+//size of the panel ram (200 lines of 25 bytes)
+#define SIM_PANEL_RAM 5000
+
+typedef struct {
+    //SSD1681 state. The panel keeps its state while the ESP sleeps
+    uint8_t  bw[SIM_PANEL_RAM];     //0x24 ram
+    uint8_t  red[SIM_PANEL_RAM];    //0x26 ram
+    uint8_t  screen[SIM_PANEL_RAM]; //what is actually visible
+    uint8_t  lut[153];
+    int      lutLoaded;             //custom LUT written through 0x32
+    int      pingpong;              //0x37 ping pong bit for mode 2
+    int      sleeping;              //0 awake, 1 or 2 deep sleep mode
+    int      entryMode;
+    int      xStart, xEnd, yStart, yEnd;
+    int      x, y;
+    int      ramTarget;             //0 none, 0x24 or 0x26
+    int      readRed;               //0x41, read RAM 0x26 instead of 0x24
+    int      cmd;                   //last command byte
+    int      argc;                  //data bytes received for cmd
+    uint8_t  args[8];
+    int      updateOption;          //0x22 parameter
+    int      tempReg;               //temperature register, 12 bits in 1/16 degrees
+    int64_t  busyUntil;             //virtual time busy is released
+    int      rstLevel;
+    int      staleRed;              //partial update on a red ram mismatch
+    int      fullUpdates;           //since the start of the simulation
+    int      partialUpdates;
+    int      regionalUpdates;       //mode 2 updates that drive unchanged pixels
+} sim_panel_t;
+
+typedef struct {
+    double   hoursPos;              //position of the hours ring in slots
+    double   hourglassPos;          //position of the hourglass ring in half turns
+    int32_t  vactual[2];            //last VACTUAL written per motor
+    double   landingMm;             //distance of the hours ring from its last position
+} sim_rings_t;
+
+typedef struct {
+    //persistent state
+    int64_t  now;                   //virtual µs since power on of the simulation
+    int64_t  rtcOffset;             //µs to add to now to get the ESP RTC time
+    int64_t  epoch;                 //true unix time at simulation start
+    int      resetReason;
+    int      wakeupCause;
+    int      wakes;
+    sim_panel_t panel;
+    sim_rings_t rings;
+    double   temperature;           //degrees C around the clock
+    int      panelMaxHz;            //fastest SPI clock the panel takes reliably
+    struct {
+        char     key[16];
+        uint32_t value;
+    } nvs[SIM_NVS_KEYS];
+    //wake result, written by the child
+    int64_t  sleepUs;
+    int      cycle;
+    int64_t  activeUs;
+    double   activeUAs;             //µA·s drawn by the ESP while awake
+    double   panelUAs;              //µA·s drawn by the panel and ULP
+    int64_t  panelBusyUs;
+    int64_t  motorUs;
+    int64_t  lightSleepUs;
+    int      spiBytes;
+    int      spiTransactions;
+    int      timerCallbacks;
+    int      interrupts;            //GPIO interrupt handlers that ran
+    int      rotated;               //hours ring stopped at
+    int      updates;
+    uint32_t screenHash;
+    uint32_t spiHash;               //bytes and DC level sent to the panel
+} sim_world_t;
+
+extern sim_world_t *sim;
+extern int sim_verbose;
+
+//virtual clock
+int64_t sim_now(void);
+void    sim_spend(int64_t us);      //busy CPU time in the current task
+void    sim_set_load(int load, double mA);
+int64_t sim_wake_start(void);
+
+//scheduler
+void    sim_sched_init(void);
+void    sim_task_delay(int64_t us);
+void    sim_timers_run(int64_t until);
+void    sim_light_sleep(int64_t until);
+int64_t sim_timers_next(void);
+
+//wake bookkeeping
+void    sim_note_cycle(int cycle);
+void    sim_rtc_save(void);
+void    sim_wake_end(int64_t sleepUs) __attribute__((noreturn));
+
+//peripherals
+int     sim_gpio_output(int pin);
+void    sim_gpio_changed(int pin, int level);
+int64_t sim_gpio_next_edge(void);
+int     sim_gpio_isr_run(void);
+int64_t sim_gpio_wakeup_at(void);
+void    sim_panel_spi(const uint8_t *data, int len, int dc);
+void    sim_panel_read(uint8_t *data, int len);
+void    sim_panel_rst(int level);
+int     sim_panel_busy(void);
+void    sim_panel_ulp_sleep(void);
+void    sim_rings_advance(int64_t from, int64_t to);
+void    sim_rings_vactual(int motor, int32_t value);
+int     sim_rings_sensor(int pin);
+int64_t sim_rings_next_change(int pin);
+int     sim_rings_hour(void);
+
+#endif
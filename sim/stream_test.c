@@ -0,0 +1,210 @@
+/* stream_test.c
+ * Host test of the bytes the e-ink driver sends to the panel.
+ * Runs a fixed sequence of eink_cmd, eink_data and eink_dataBuffer
+ * calls (init, ram window, LUT, frame data, update, deep sleep) on the
+ * SPI model of the simulation and compares every byte and its DC level
+ * with stream_ref.txt.
+ *
+ * stream_ref.txt was recorded with the eink.c from before the commands
+ * were collected in a list, when every call was its own transaction,
+ * so the list and the flushes must not change what the panel gets.
+ * stream_test -w writes the stream instead, one line per DC level run:
+ * C or D and up to 16 bytes in hex.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+//the static functions of the driver are called directly
+#include "../main/eink.c"
+
+sim_world_t *sim;
+int sim_verbose=0;
+
+#define STREAM_MAX 20000
+
+static uint8_t streamBytes[STREAM_MAX];
+static uint8_t streamDc[STREAM_MAX];
+static int streamLen=0;
+
+//the panel of the simulation is replaced by a log of what it gets.
+//It is never busy
+void sim_panel_spi(const uint8_t *data, int len, int dc) {
+    for(int i=0; i<len; i++) {
+        if(streamLen==STREAM_MAX) {
+            fprintf(stderr, "stream longer than %d bytes\n", STREAM_MAX);
+            exit(1);
+        }
+        streamBytes[streamLen]=data[i];
+        streamDc[streamLen]=dc!=0;
+        streamLen++;
+    }
+}
+
+void sim_panel_read(uint8_t *data, int len) {
+    memset(data, 0, len);
+}
+
+void sim_panel_rst(int level) {
+}
+
+int sim_panel_busy(void) {
+    return 0;
+}
+
+void sim_panel_ulp_sleep(void) {
+}
+
+void sim_note_cycle(int cycle) {
+}
+
+void sim_rtc_save(void) {
+}
+
+void sim_wake_end(int64_t sleepUs) {
+    fprintf(stderr, "deep sleep in the stream test\n");
+    exit(1);
+}
+
+static uint8_t frame[2600+8];   //the red ram is written from frame+i
+static uint8_t lut[159];
+
+//the calls. Where the driver waits for the display the list is
+//flushed, as eink_waitBusy does
+static void stream_calls(void) {
+    for(int i=0; i<(int)sizeof(frame); i++) frame[i]=(uint8_t)(i*37+(i>>8));
+    for(int i=0; i<(int)sizeof(lut); i++) lut[i]=(uint8_t)(255-i*3);
+
+    //init
+    eink_cmd(0x12); // soft reset
+    eink_flush();
+    eink_cmd(0x01); // Driver output control
+    eink_data(0xC7);
+    eink_data(0x00);
+    eink_data(0x00);
+    eink_cmd(0x18); //temperature sensor
+    eink_data(0x80);
+    eink_cmd(0x22);
+    eink_data(0xB1);
+    eink_cmd(0x20);
+    eink_flush();
+
+    //LUT and voltages, as eink_load_waveform
+    eink_cmd(0x32);
+    eink_dataBuffer(lut, 153);
+    eink_cmd(0x3F);
+    eink_data(lut[153]);
+    eink_cmd(0x03);
+    eink_data(lut[154]);
+    eink_cmd(0x04);
+    eink_data(lut[155]);
+    eink_data(lut[156]);
+    eink_data(lut[157]);
+    eink_cmd(0x2C);
+    eink_data(lut[158]);
+    eink_cmd(0x37);
+    eink_dataBuffer(WF_PARTIAL_MODE, 10);
+    eink_cmd(0x3C);
+    eink_data(0x80);
+
+    //windows of every size the driver writes: from the list, the
+    //largest buffer the list takes, one polled transaction and bands
+    static const int sizes[] = { 1, 16, 17, 1024, 1025, 2600 };
+    for(int i=0; i<(int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+        eink_set_rampointer(i, 2*i, 200-i, 25-i);
+        eink_cmd(0x24);
+        eink_dataBuffer(frame, sizes[i]);
+        eink_cmd(0x26);
+        eink_dataBuffer(frame+i, sizes[i]);
+    }
+
+    //more single bytes than the list holds
+    eink_cmd(0x24);
+    for(int i=0; i<100; i++) eink_data(frame[i]);
+    //more DC changes than the list has runs
+    for(int i=0; i<40; i++) {
+        eink_cmd(0x4E);
+        eink_data(i);
+    }
+
+    //update and deep sleep
+    eink_cmd(0x22);
+    eink_data(0xCF);
+    eink_cmd(0x20);
+    eink_flush();
+    eink_cmd(0x10);
+    eink_data(0x01);
+    eink_flush();
+}
+
+static void stream_write(FILE *f) {
+    for(int i=0; i<streamLen; ) {
+        fputc(streamDc[i]?'D':'C', f);
+        int n=0;
+        do {
+            fprintf(f, " %02x", streamBytes[i]);
+            i++;
+            n++;
+        } while(i<streamLen && streamDc[i]==streamDc[i-1] && n<16);
+        fputc('\n', f);
+    }
+}
+
+int main(int argc, char **argv) {
+    int record=argc>1 && strcmp(argv[1], "-w")==0;
+    const char *ref=argc>1+record?argv[1+record]:"stream_ref.txt";
+    sim=calloc(1, sizeof(*sim));
+    sim->panelMaxHz=SPI_MAX_FREQUENCY;
+    sim->panel.rstLevel=1;
+    sim_sched_init();
+    if(!freopen("/dev/null", "w", stdout)) return 3;
+    eink_init_io();
+    stream_calls();
+
+    if(record) {
+        FILE *f=fopen(ref, "w");
+        if(!f) {
+            perror(ref);
+            return 1;
+        }
+        stream_write(f);
+        fclose(f);
+        return 0;
+    }
+
+    //compare with the reference line by line
+    char *text=NULL;
+    size_t size=0;
+    FILE *s=open_memstream(&text, &size);
+    stream_write(s);
+    fclose(s);
+    FILE *f=fopen(ref, "r");
+    if(!f) {
+        perror(ref);
+        return 1;
+    }
+    char line[80];
+    char *p=text;
+    int lineNo=1;
+    while(fgets(line, sizeof(line), f)) {
+        char *end=strchr(p, '\n');
+        size_t len=end?(size_t)(end-p+1):strlen(p);
+        if(len!=strlen(line) || memcmp(p, line, len)!=0) {
+            fprintf(stderr, "%s:%d: expected %s", ref, lineNo, line);
+            fprintf(stderr, "%s:%d:      got %.*s", ref, lineNo, (int)len, p);
+            return 1;
+        }
+        p+=len;
+        lineNo++;
+    }
+    fclose(f);
+    if(*p) {
+        fprintf(stderr, "%s:%d: more bytes than recorded: %.*s\n", ref, lineNo,
+                (int)(strchr(p, '\n')-p), p);
+        return 1;
+    }
+    fprintf(stderr, "Panel stream of %d bytes matches %s\n", streamLen, ref);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Generate the bitmaps of the e-ink display from images and a font.
+
+Reads a list of assets (main/assets/assets.txt) and writes the tables
+digits, bitmaps and font in the layout eink_draw_bitmap expects. Every
+line of the list adds one bitmap to a table:
+
+  digits     zero.png
+  font       font.bdf    33-126
+
+Images are PNG files drawn as they appear on the display. Black pixels
+(dark and at least half opaque) are drawn, all others are left white.
+A font is a BDF file. A range of characters adds one bitmap per
+character, one character cell wide and the font height high. Other
+fonts (TTF for instance) can be converted to BDF with otf2bdf or
+fontforge at the required size.
+
+The display buffer is rotated so a bitmap is stored as vertical lines
+from right to left. Every line holds the pixels from top to bottom, 8
+pixels per byte with the top pixel in the most significant bit, and 0
+for black. The height is padded with white to full bytes.
+
+The output is run length encoded by bitmap_pack.py unless --raw is
+given, which writes the plain arrays.
+
+usage: bitmap_gen.py [--raw] -o bitmaps_packed.c main/assets/assets.txt
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+import bitmap_pack
+
+
+def read_png(path):
+    """Return the image in path as rows of booleans, True is black."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG file' % path)
+    pos = 8
+    idat = b''
+    palette = b''
+    trns = b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = chunk
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+    if interlace:
+        sys.exit('%s: interlaced PNG files are not supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = depth * channels
+    stride = (width * bits + 7) // 8
+    step = max(1, bits // 8)  # bytes per pixel for the filters
+    raw = zlib.decompress(idat)
+
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - step] if i >= step else 0
+            b = prev[i]
+            c = prev[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+
+        row = []
+        for x in range(width):
+            samples = []
+            for ch in range(channels):
+                n = x * channels + ch
+                if depth == 8:
+                    samples.append(line[n])
+                elif depth == 16:
+                    samples.append(line[2 * n])
+                else:
+                    v = (line[n * depth // 8] >> (8 - depth - n * depth % 8)) & ((1 << depth) - 1)
+                    samples.append(v if color == 3 else v * 255 // ((1 << depth) - 1))
+            alpha = 255
+            if color == 3:
+                i = samples[0]
+                alpha = trns[i] if i < len(trns) else 255
+                samples = list(palette[3 * i:3 * i + 3])
+            elif color in (4, 6):
+                alpha = samples.pop()
+            grey = sum(samples) // len(samples)
+            row.append(alpha >= 128 and grey < 128)
+        rows.append(row)
+    return rows
+
+
+def read_bdf(path):
+    """Return (ascent, descent, glyphs) of the font in path.
+
+    glyphs maps a character code to (advance, rows), rows holds the
+    glyph cell from top to bottom as rows of booleans, True is ink.
+    """
+    ascent = descent = None
+    glyphs = {}
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONT_ASCENT':
+            ascent = int(words[1])
+        elif words[0] == 'FONT_DESCENT':
+            descent = int(words[1])
+        elif words[0] == 'FONTBOUNDINGBOX' and ascent is None:
+            ascent = int(words[2]) + int(words[4])
+            descent = -int(words[4])
+        elif words[0] == 'STARTCHAR':
+            code = advance = bbx = None
+            bitmap = []
+            for line in lines:
+                words = line.split()
+                if words[0] == 'ENCODING':
+                    code = int(words[1])
+                elif words[0] == 'DWIDTH':
+                    advance = int(words[1])
+                elif words[0] == 'BBX':
+                    bbx = [int(v) for v in words[1:5]]
+                elif words[0] == 'BITMAP':
+                    for line in lines:
+                        if line.strip() == 'ENDCHAR':
+                            break
+                        bitmap.append(int(line, 16))
+                    break
+            w, h, xoff, yoff = bbx
+            if advance is None:
+                advance = w + xoff
+            height = ascent + descent
+            rows = [[False] * advance for _ in range(height)]
+            bytewidth = (w + 7) // 8
+            for r, v in enumerate(bitmap):
+                y = ascent - (yoff + h) + r
+                for c in range(w):
+                    x = xoff + c
+                    if 0 <= y < height and 0 <= x < advance and v >> (bytewidth * 8 - 1 - c) & 1:
+                        rows[y][x] = True
+            glyphs[code] = (advance, rows)
+    if ascent is None:
+        sys.exit('%s: no font ascent' % path)
+    return ascent, descent, glyphs
+
+
+def to_bitmap(rows):
+    """Convert rows of booleans into (width, height, bytes) of the display."""
+    width = len(rows[0]) if rows else 0
+    height = (len(rows) + 7) // 8
+    data = bytearray()
+    for x in reversed(range(width)):
+        for byte in range(height):
+            v = 0xFF
+            for bit in range(8):
+                y = byte * 8 + bit
+                if y < len(rows) and rows[y][x]:
+                    v &= ~(0x80 >> bit)
+            data.append(v)
+    return width, height, bytes(data)
+
+
+def char_comment(code):
+    c = chr(code)
+    return "'\"'" if c == '"' else '"%s"' % c
+
+
+def load(listing):
+    """Read the asset list. Returns arrays, tables and comments."""
+    base = os.path.dirname(listing)
+    arrays = {}
+    tables = {}
+    comments = {}
+    fonts = {}
+    with open(listing) as f:
+        for number, line in enumerate(f, 1):
+            words = line.split('#')[0].split()
+            if not words:
+                continue
+            table, source = words[0], words[1]
+            path = os.path.join(base, source)
+            name, ext = os.path.splitext(source)
+            entries = tables.setdefault(table, [])
+            if ext == '.png':
+                arrays[name] = to_bitmap(read_png(path))
+                entries.append(name)
+            elif ext == '.bdf' and len(words) == 3:
+                if path not in fonts:
+                    fonts[path] = read_bdf(path)
+                glyphs = fonts[path][2]
+                first, last = (int(v) for v in words[2].split('-'))
+                for code in range(first, last + 1):
+                    if code not in glyphs:
+                        sys.exit('%s:%d: %s has no character %d' % (listing, number, source, code))
+                    name = 'char%d' % code
+                    arrays[name] = to_bitmap(glyphs[code][1])
+                    comments[name] = char_comment(code)
+                    entries.append(name)
+            else:
+                sys.exit('%s:%d: expected an image or a font with a range' % (listing, number))
+    return arrays, tables, comments
+
+
+def write_raw(path, origin, arrays, tables, comments):
+    lines = ['//Generated by tools/bitmap_gen.py from %s. Do not edit.' % origin,
+             '#include <stdint.h>',
+             '']
+    for name, (width, height, data) in arrays.items():
+        comment = '  // %s' % comments[name] if name in comments else ''
+        lines.append('static const uint8_t %s[] = {%s' % (name, comment))
+        lines.append('  %d, %d, //%d vertical lines of %d bytes' % (width, height, width, height))
+        for i in range(0, len(data), height):
+            lines.append('  ' + ' '.join('0x%02x,' % b for b in data[i:i + height]))
+        lines.append('};')
+        lines.append('')
+    for name, entries in tables.items():
+        lines.append('const uint8_t *%s[] = {' % name)
+        lines.extend('  %s,' % e for e in entries)
+        lines.append('};')
+        lines.append('')
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the e-ink bitmaps from images and fonts')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--raw', action='store_true', help='write the arrays without run length encoding')
+    parser.add_argument('listing')
+    args = parser.parse_args()
+
+    arrays, tables, comments = load(args.listing)
+    origin = args.listing.split('/')[-1]
+    if args.raw:
+        write_raw(args.output, origin, arrays, tables, comments)
+    else:
+        bitmap_pack.write_packed(args.output, origin, arrays, tables)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Pack the bitmaps of the e-ink display.
+
+Reads C sources holding plain bitmap arrays (as written by
+bitmap_gen.py --raw) and writes one C source with the same tables
+holding run length encoded bitmaps. bitmap_gen.py uses it to pack the
+bitmaps as part of the build.
+
+A bitmap starts with its width (number of vertical lines) and height
+(bytes per line) followed by width*height bytes. The packed bitmap
+keeps width and height and encodes the bytes as tokens:
+
+  0x00-0x3F  token+1 literal bytes follow
+  0x40-0x7F  token-0x3F white bytes (0xFF)
+  0x80-0xBF  token-0x7F black bytes (0x00)
+  0xC0-0xFF  token-0xBF times the byte that follows
+
+Runs continue over line boundaries. eink_draw_bitmap decodes them.
+Identical bitmaps are stored once.
+
+usage: bitmap_pack.py -o bitmaps_packed.c bitmaps.c
+"""
+import argparse
+import re
+import sys
+
+RLE_LITERAL = 0x00
+RLE_WHITE = 0x40
+RLE_BLACK = 0x80
+RLE_REPEAT = 0xC0
+RLE_MAX = 64
+
+ARRAY = re.compile(r'static\s+const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', re.S)
+TABLE = re.compile(r'const\s+uint8_t\s*\*\s*(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', re.S)
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def parse(path, arrays, tables):
+    with open(path) as f:
+        text = strip_comments(f.read())
+    for name, body in ARRAY.findall(text):
+        values = [int(v, 0) for v in body.replace(',', ' ').split()]
+        width, height = values[0], values[1]
+        data = values[2:]
+        if len(data) != width * height:
+            sys.exit('%s: %s has %d bytes, expected %dx%d' % (path, name, len(data), width, height))
+        arrays[name] = (width, height, bytes(data))
+    for name, body in TABLE.findall(text):
+        tables[name] = body.replace(',', ' ').split()
+
+
+def encode(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:RLE_MAX]
+            out.append(RLE_LITERAL + len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:RLE_MAX]
+
+    i = 0
+    while i < len(data):
+        b = data[i]
+        run = 1
+        while i + run < len(data) and data[i + run] == b and run < RLE_MAX:
+            run += 1
+        if b in (0xFF, 0x00):
+            flush_literal()
+            out.append((RLE_WHITE if b == 0xFF else RLE_BLACK) + run - 1)
+        elif run >= 3:
+            flush_literal()
+            out.extend((RLE_REPEAT + run - 1, b))
+        else:
+            literal.extend(data[i:i + run])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def decode(width, height, packed):
+    out = bytearray()
+    i = 0
+    while len(out) < width * height:
+        t = packed[i]
+        i += 1
+        n = (t & 0x3F) + 1
+        kind = t & 0xC0
+        if kind == RLE_LITERAL:
+            out.extend(packed[i:i + n])
+            i += n
+        elif kind == RLE_WHITE:
+            out.extend(b'\xff' * n)
+        elif kind == RLE_BLACK:
+            out.extend(b'\x00' * n)
+        else:
+            out.extend(bytes([packed[i]]) * n)
+            i += 1
+    return bytes(out)
+
+
+def write_packed(path, origin, arrays, tables):
+    """Write arrays (name: (width, height, bytes)) packed into path.
+
+    tables maps a table name to the names of its bitmaps. Identical
+    bitmaps are stored once.
+    """
+    raw = 0
+    packed = 0
+    same = {}
+    first = {}
+    lines = ['//Generated by tools/%s from %s. Do not edit.' % (
+                 sys.argv[0].split('/')[-1], origin),
+             '//Bitmaps are run length encoded, see eink_draw_bitmap.',
+             '#include <stdint.h>',
+             '']
+    for name, (width, height, data) in arrays.items():
+        raw += 2 + len(data)
+        if (width, height, data) in first:
+            same[name] = first[(width, height, data)]
+            continue
+        first[(width, height, data)] = name
+        enc = encode(data)
+        if decode(width, height, enc) != data:
+            sys.exit('%s does not decode to the original' % name)
+        packed += 2 + len(enc)
+        lines.append('static const uint8_t %s[] = {  //%d bytes, %d packed' % (name, len(data), len(enc)))
+        lines.append('  %d, %d,' % (width, height))
+        for i in range(0, len(enc), 16):
+            lines.append('  ' + ' '.join('0x%02x,' % b for b in enc[i:i + 16]))
+        lines.append('};')
+        lines.append('')
+    for name, entries in tables.items():
+        for entry in entries:
+            if entry not in arrays:
+                sys.exit('%s refers to unknown bitmap %s' % (name, entry))
+        lines.append('const uint8_t *%s[] = {' % name)
+        lines.extend('  %s,' % same.get(entry, entry) for entry in entries)
+        lines.append('};')
+        lines.append('')
+    lines.append('//%d bitmaps, %d bytes packed into %d' % (len(arrays), raw, packed))
+
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run length encode the e-ink bitmaps')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('sources', nargs='+')
+    args = parser.parse_args()
+
+    arrays = {}
+    tables = {}
+    for path in args.sources:
+        parse(path, arrays, tables)
+    write_packed(args.output, ', '.join(p.split('/')[-1] for p in args.sources), arrays, tables)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Generate the decoding tables of the rotating code of the hours ring.
+
+Reads the magnet layout (main/rotate_code.txt) and writes the tables
+rotate.c decodes the hall sensors with:
+
+  expectMap          sensor value at every hour. Continues up to index
+                     19 so the value of the position 5 hours ahead and
+                     5 hours back (+7) can be looked up directly.
+  sensorsMappingCC   hour of a position from the sensor value of the
+  sensorsMappingCW   position passed before it (times 8) and its own
+                     sensor value, turning counter clockwise or
+                     clockwise. 0 for pairs that don't occur.
+
+The layout is checked for what the firmware relies on and the build
+fails when it doesn't hold:
+  - the hours follow each other in steps of 5, the ring turns 5 hours
+    per position
+  - every position triggers at least one sensor, so the zero state
+    between positions separates them
+  - every two consecutive positions tell the hour, in both directions
+  - the sensor values of 1 and 2 o'clock are unique, so the clock can
+    verify where it is on the daylight saving time changes
+
+usage: rotate_code_gen.py -o rotate_code.c main/rotate_code.txt
+"""
+import argparse
+import sys
+
+
+def load(path):
+    """Read the layout. Returns hours, magnets and (bit, offset) sensors."""
+    hours = magnets = None
+    sensors = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            words = line.split('#')[0].split()
+            if not words:
+                continue
+            try:
+                if words[0] == 'hours':
+                    hours = [int(w) for w in words[1:]]
+                elif words[0] == 'magnets':
+                    magnets = [int(w) for w in words[1:]]
+                elif words[0] == 'sensor' and len(words) == 3:
+                    sensors.append((int(words[1], 0), int(words[2])))
+                else:
+                    raise ValueError
+            except ValueError:
+                sys.exit('%s:%d: expected hours, magnets or sensor <bit> <offset>' % (path, number))
+    if hours is None or magnets is None or not sensors:
+        sys.exit('%s: needs hours, magnets and sensors' % path)
+    return hours, magnets, sensors
+
+
+def check(path, hours, magnets, sensors):
+    """Exit with a message when the firmware can't decode the layout."""
+    def fail(message):
+        sys.exit('%s: %s' % (path, message))
+    if sorted(hours) != list(range(1, 13)) or len(magnets) != 12:
+        fail('needs 12 hours, each once, and 12 magnets')
+    for i, hour in enumerate(hours):
+        if hours[(i + 1) % 12] != (hour + 4) % 12 + 1:
+            fail('%d is not followed by %d' % (hour, (hour + 4) % 12 + 1))
+    if len(set(bit for bit, _ in sensors)) != len(sensors) or any(bit not in (1, 2, 4) for bit, _ in sensors):
+        fail('the sensors need the bits 0x01, 0x02 and 0x04 once')
+
+
+def codes(hours, magnets, sensors):
+    """Sensor value per hour."""
+    code = {}
+    for i, hour in enumerate(hours):
+        code[hour] = sum(bit for bit, offset in sensors if magnets[(i + offset) % 12])
+    return code
+
+
+def tables(path, hours, magnets, sensors):
+    """Return expectMap, sensorsMappingCC and sensorsMappingCW."""
+    code = codes(hours, magnets, sensors)
+    for hour in hours:
+        if code[hour] == 0:
+            sys.exit('%s: no sensor sees a magnet at %d o\'clock' % (path, hour))
+    for hour in (1, 2):
+        others = [h for h in hours if h != hour and code[h] == code[hour]]
+        if others:
+            sys.exit('%s: %d o\'clock has the same sensor value as %s' % (path, hour, others[0]))
+    expect = [0] + [code[(h - 1) % 12 + 1] for h in range(1, 20)]
+    mappings = []
+    for step in (5, 7):  # counter clockwise adds 5 hours, clockwise 7
+        mapping = [0] * 64
+        for hour in hours:
+            before = (hour - step - 1) % 12 + 1
+            index = code[before] * 8 + code[hour]
+            if mapping[index]:
+                sys.exit('%s: %d and %d o\'clock both follow sensor value %d with %d %s' %
+                         (path, mapping[index], hour, code[before], code[hour],
+                          'counter clockwise' if step == 5 else 'clockwise'))
+            mapping[index] = hour
+        mappings.append(mapping)
+    return expect, mappings[0], mappings[1]
+
+
+def mapping_lines(name, mapping, direction):
+    lines = ['//hour from the sensor value before (row) and now (column)',
+             '//when rotating %s. 0 means invalid' % direction,
+             'const int8_t %s[64] = {' % name,
+             '//   0   1   2   3   4   5   6   7   new/cur']
+    for row in range(8):
+        values = ''.join('%3d,' % v for v in mapping[row * 8:row * 8 + 8])
+        lines.append('   %s     //%d' % (values, row))
+    lines.append('};')
+    lines.append('')
+    return lines
+
+
+def write(path, origin, expect, cc, cw):
+    lines = ['//Generated by tools/rotate_code_gen.py from %s. Do not edit.' % origin,
+             '#include "rotate_code.h"',
+             '']
+    lines += mapping_lines('sensorsMappingCC', cc, 'counter clockwise')
+    lines += mapping_lines('sensorsMappingCW', cw, 'clockwise')
+    lines += ['//sensor value per hour, index 13-19 repeat 1-7',
+              'const uint8_t expectMap[20] = {',
+              '//' + ''.join('%3d ' % i for i in range(20)),
+              '  ' + ''.join('%3d,' % v for v in expect),
+              '};',
+              '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the decoding tables of the hours ring')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('layout')
+    args = parser.parse_args()
+
+    hours, magnets, sensors = load(args.layout)
+    check(args.layout, hours, magnets, sensors)
+    expect, cc, cw = tables(args.layout, hours, magnets, sensors)
+    write(args.output, args.layout.split('/')[-1], expect, cc, cw)
+
+
+if __name__ == '__main__':
+    main()